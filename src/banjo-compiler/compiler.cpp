@@ -1,7 +1,9 @@
 #include "compiler.hpp"
 
 #include "banjo/ast/ast_writer.hpp"
+#include "banjo/codegen/build_cache.hpp"
 #include "banjo/codegen/machine_pass_runner.hpp"
+#include "banjo/codegen/parallel_backend.hpp"
 #include "banjo/codegen/ssa_lowerer.hpp"
 #include "banjo/config/config.hpp"
 #include "banjo/passes/pipeline.hpp"
@@ -14,15 +16,22 @@
 #include "banjo/ssa/module.hpp"
 #include "banjo/ssa/writer.hpp"
 #include "banjo/ssa_gen/ssa_generator.hpp"
+#include "banjo/utils/paths.hpp"
 #include "banjo/utils/timing.hpp"
 
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <string>
 
 namespace banjo {
 
-Compiler::Compiler(const Config &config) : config(config), module_manager(report_manager) {}
+Compiler::Compiler(const Config &config)
+  : config(config),
+    task_scheduler(config.num_jobs),
+    module_manager(report_manager) {}
 
 void Compiler::compile() {
     ReportPrinter report_printer;
@@ -46,6 +55,7 @@ void Compiler::compile() {
 
     module_manager.add_standard_stdlib_search_path();
     module_manager.add_config_search_paths(config);
+    module_manager.set_task_scheduler(&task_scheduler);
     module_manager.load_all();
 
     if (config.debug) {
@@ -96,11 +106,20 @@ void Compiler::compile() {
     PROFILE_SECTION_END("OPTIMIZATION");
     PROFILE_SECTION_BEGIN("BACKEND");
 
-    codegen::SSALowerer *ssa_lowerer = target->create_ssa_lowerer();
-    mcode::Module machine_module = ssa_lowerer->lower_module(ssa_module);
-    delete ssa_lowerer;
+    mcode::Module machine_module;
+    std::unique_ptr<codegen::BuildCache> build_cache = create_build_cache();
 
-    codegen::MachinePassRunner(target).create_and_run(machine_module);
+    if (build_cache) {
+        machine_module = codegen::ParallelBackend(target, task_scheduler, build_cache.get()).generate(ssa_module);
+    } else if (config.num_jobs > 1 && target->supports_parallel_codegen() && !config.debug) {
+        machine_module = codegen::ParallelBackend(target, task_scheduler).generate(ssa_module);
+    } else {
+        codegen::SSALowerer *ssa_lowerer = target->create_ssa_lowerer();
+        machine_module = ssa_lowerer->lower_module(ssa_module);
+        delete ssa_lowerer;
+
+        codegen::MachinePassRunner(target).create_and_run(machine_module);
+    }
 
     std::ofstream stream("output." + target->get_output_file_ext(), std::ios::binary);
     codegen::Emitter *emitter = target->create_emitter(machine_module, stream);
@@ -109,7 +128,54 @@ void Compiler::compile() {
 
     PROFILE_SECTION_END("BACKEND");
 
+    if (build_cache) {
+        build_cache->evict();
+
+        if (config.cache_stats) {
+            print_cache_stats(build_cache->get_stats());
+        }
+    }
+
     delete target;
 }
 
+std::unique_ptr<codegen::BuildCache> Compiler::create_build_cache() {
+    // Debug builds dump intermediate representations of every function and hot reloading builds
+    // need the address table, so both always go through the complete backend.
+    if (!config.cache_dir || !target->supports_build_cache() || config.debug || config.hot_reload) {
+        return nullptr;
+    }
+
+    // The compiler executable is part of the settings so that entries produced by other builds of
+    // the compiler with the same version number are never reused.
+    std::string settings = BANJO_VERSION;
+    std::error_code error_code;
+    std::filesystem::path executable = Paths::executable();
+    std::uintmax_t executable_size = std::filesystem::file_size(executable, error_code);
+    auto executable_time = std::filesystem::last_write_time(executable, error_code).time_since_epoch().count();
+
+    settings += ";" + std::to_string(executable_size) + ";" + std::to_string(executable_time);
+    settings += ";" + target->get_descr().to_string();
+    settings += ";" + std::to_string(static_cast<int>(target->get_code_model()));
+    settings += ";" + std::to_string(config.opt_level);
+    settings += ";" + std::to_string(config.pic);
+
+    return std::make_unique<codegen::BuildCache>(codegen::BuildCache::Settings{
+        .dir = *config.cache_dir,
+        .size_limit = static_cast<std::uint64_t>(config.cache_size_limit) * 1024 * 1024,
+        .settings_hash = codegen::BuildCache::hash_string(settings),
+    });
+}
+
+void Compiler::print_cache_stats(const codegen::BuildCache::Stats &stats) {
+    unsigned num_lookups = stats.num_hits + stats.num_misses;
+    double hit_rate = num_lookups == 0 ? 0.0 : 100.0 * stats.num_hits / num_lookups;
+    double size_mib = static_cast<double>(stats.size) / (1024 * 1024);
+
+    std::cerr << "build cache: " << stats.num_hits << " hits, " << stats.num_misses << " misses ("
+              << std::fixed << std::setprecision(1) << hit_rate << "% hit rate), " << stats.num_stores
+              << " stored, " << stats.num_evictions << " evicted, " << stats.num_entries << " entries ("
+              << size_mib << " MiB)\n";
+}
+
 } // namespace banjo
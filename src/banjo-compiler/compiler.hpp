@@ -1,10 +1,14 @@
 #ifndef BANJO_COMPILER_H
 #define BANJO_COMPILER_H
 
+#include "banjo/codegen/build_cache.hpp"
 #include "banjo/config/config.hpp"
 #include "banjo/reports/report_manager.hpp"
 #include "banjo/source/module_manager.hpp"
 #include "banjo/target/target.hpp"
+#include "banjo/utils/task_scheduler.hpp"
+
+#include <memory>
 
 namespace banjo {
 
@@ -13,12 +17,17 @@ class Compiler {
 private:
     const Config &config;
     target::Target *target;
+    utils::TaskScheduler task_scheduler;
     ReportManager report_manager;
     ModuleManager module_manager;
 
 public:
     Compiler(const Config &config);
     void compile();
+
+private:
+    std::unique_ptr<codegen::BuildCache> create_build_cache();
+    void print_cache_stats(const codegen::BuildCache::Stats &stats);
 };
 
 } // namespace banjo
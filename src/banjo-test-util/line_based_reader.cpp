@@ -42,7 +42,9 @@ void LineBasedReader::skip_whitespace() {
 }
 
 void LineBasedReader::skip_char(char c) {
-    ASSERT(consume() == c);
+    // The character has to be consumed outside of the assertion because assertions are removed in release builds.
+    [[maybe_unused]] char consumed = consume();
+    ASSERT(consumed == c);
 }
 
 std::string_view LineBasedReader::read_until_whitespace() {
@@ -28,6 +28,9 @@ const std::unordered_map<std::string_view, ssa::Primitive> PRIMITIVES = {
     {"i64", ssa::Primitive::I64},
     {"f32", ssa::Primitive::F32},
     {"f64", ssa::Primitive::F64},
+    {"f32x4", ssa::Primitive::F32X4},
+    {"f64x2", ssa::Primitive::F64X2},
+    {"i32x4", ssa::Primitive::I32X4},
     {"addr", ssa::Primitive::ADDR},
 };
 
@@ -72,6 +75,7 @@ const std::unordered_map<std::string_view, ssa::Opcode> OPS = {
     {"offsetptr", ssa::Opcode::OFFSETPTR},
     {"copy", ssa::Opcode::COPY},
     {"sqrt", ssa::Opcode::SQRT},
+    {"splat", ssa::Opcode::SPLAT},
 };
 
 const std::unordered_map<std::string_view, ssa::Comparison> COMPARISONS = {
@@ -158,11 +162,12 @@ ssa::Module SSAParser::parse() {
         } else if (start.starts_with("@")) {
             ssa::Function *cur_func = mod.get_functions().back();
 
-            std::string label = std::string(start).substr(1, start.size() - 2);
+            std::string label = parse_block_label();
             cur_func->basic_blocks.append(ssa::BasicBlock(label));
 
             ssa::BasicBlockIter iter = cur_func->basic_blocks.get_last_iter();
             blocks.insert({iter->get_label(), iter});
+            parse_block_params(*iter);
         }
     }
 
@@ -193,12 +198,17 @@ ssa::Module SSAParser::parse() {
             cur_block = nullptr;
             cur_struct = mod.get_structure(name);
         } else if (start.starts_with("@")) {
-            std::string label = std::string(start).substr(1, start.size() - 2);
+            std::string label = parse_block_label();
             cur_block = blocks.at(label);
         } else if (start.starts_with("%")) {
             unsigned reg_number = std::stoul(std::string(start).substr(1));
             ssa::VirtualRegister reg = static_cast<ssa::VirtualRegister>(reg_number);
 
+            // Keep registers created by passes from clashing with the ones in large inputs.
+            if (reg >= cur_func->last_virtual_reg) {
+                cur_func->set_next_reg(reg + 1);
+            }
+
             reader.skip_whitespace();
             reader.skip_char('=');
             reader.skip_whitespace();
@@ -293,9 +303,57 @@ std::vector<ssa::Type> SSAParser::parse_params() {
     return params;
 }
 
+std::string SSAParser::parse_block_label() {
+    reader.restart_line();
+    reader.skip_whitespace();
+    reader.skip_char('@');
+
+    std::string label;
+
+    while (reader.get() != '(' && reader.get() != ':' && reader.get() != '\0') {
+        label += reader.consume();
+    }
+
+    return label;
+}
+
+void SSAParser::parse_block_params(ssa::BasicBlock &block) {
+    if (reader.get() != '(') {
+        return;
+    }
+
+    reader.consume();
+    reader.skip_whitespace();
+
+    while (reader.get() != ')') {
+        ssa::Type type = parse_type();
+        reader.skip_whitespace();
+        reader.skip_char('%');
+
+        std::string reg_number;
+
+        while (LineBasedReader::is_numeric(reader.get())) {
+            reg_number += reader.consume();
+        }
+
+        block.get_param_types().push_back(type);
+        block.get_param_regs().push_back(static_cast<ssa::VirtualRegister>(std::stoul(reg_number)));
+        reader.skip_whitespace();
+
+        if (reader.get() == ',') {
+            reader.skip_char(',');
+            reader.skip_whitespace();
+        } else {
+            ASSERT(reader.get() == ')');
+        }
+    }
+
+    reader.consume();
+}
+
 ssa::Instruction SSAParser::parse_instr(std::optional<ssa::VirtualRegister> dst) {
     ssa::Opcode op = parse_op();
-    std::vector<ssa::Operand> operands = parse_operands();
+    ssa::Instruction::OperandList operands = parse_operands();
     return {op, dst, operands};
 }
 
@@ -306,10 +364,10 @@ ssa::Opcode SSAParser::parse_op() {
     return OPS.at(string);
 }
 
-std::vector<ssa::Operand> SSAParser::parse_operands() {
+ssa::Instruction::OperandList SSAParser::parse_operands() {
     reader.skip_whitespace();
 
-    std::vector<ssa::Operand> operands;
+    ssa::Instruction::OperandList operands;
 
     while (reader.get() != '\0' && reader.get() != '!') {
         if (std::optional<ssa::Operand> operand = parse_operand()) {
@@ -346,22 +404,25 @@ std::optional<ssa::Operand> SSAParser::parse_operand() {
     }
 
     std::string string;
+    unsigned depth = 0;
+
+    // Branch targets may have a list of arguments in parentheses, which contains commas and whitespace.
+    while (reader.get() != '\0' &&
+           (depth > 0 ||
+            (reader.get() != ',' && reader.get() != '!' && !LineBasedReader::is_whitespace(reader.get())))) {
+        if (reader.get() == '(') {
+            depth += 1;
+        } else if (reader.get() == ')') {
+            depth -= 1;
+        }
 
-    while (reader.get() != ',' && reader.get() != '\0' && reader.get() != '!' &&
-           !LineBasedReader::is_whitespace(reader.get())) {
         string += reader.consume();
     }
 
-    if (string[0] == '-' || LineBasedReader::is_numeric(string[0])) {
-        if (string.find('.') == std::string::npos) {
-            return ssa::Operand::from_int_immediate(LargeInt{string}, type);
-        } else {
-            return ssa::Operand::from_fp_immediate(std::stod(string), type);
-        }
-    } else if (string[0] == '%') {
-        unsigned reg_number = std::stoul(string.substr(1));
-        ssa::VirtualRegister reg = static_cast<ssa::VirtualRegister>(reg_number);
-        return ssa::Operand::from_register(reg, type);
+    if (string[0] == '-' || LineBasedReader::is_numeric(string[0]) || string[0] == '%') {
+        return parse_value(string, type);
+    } else if (string[0] == '@' && string.find('(') != std::string::npos) {
+        return parse_branch_target(string, type);
     } else if (string[0] == '@') {
         std::string name = string.substr(1);
 
@@ -395,5 +456,62 @@ std::optional<ssa::Operand> SSAParser::parse_operand() {
     }
 }
 
+std::optional<ssa::Operand> SSAParser::parse_branch_target(const std::string &string, ssa::Type type) {
+    std::string::size_type args_start = string.find('(');
+    std::string name = string.substr(1, args_start - 1);
+
+    auto block_iter = blocks.find(name);
+    if (block_iter == blocks.end()) {
+        return {};
+    }
+
+    ssa::BranchTarget target{
+        .block = block_iter->second,
+        .args{},
+    };
+
+    std::string args = string.substr(args_start + 1, string.size() - args_start - 2);
+    std::string::size_type arg_start = 0;
+
+    while (arg_start < args.size()) {
+        std::string::size_type arg_end = args.find(',', arg_start);
+        if (arg_end == std::string::npos) {
+            arg_end = args.size();
+        }
+
+        std::string arg = args.substr(arg_start, arg_end - arg_start);
+        arg.erase(0, arg.find_first_not_of(' '));
+
+        // Arguments are written without types, so they are taken from the parameters of the target block.
+        ssa::Type arg_type = block_iter->second->get_param_types()[target.args.size()];
+
+        if (std::optional<ssa::Operand> operand = parse_value(arg, arg_type)) {
+            target.args.push_back(*operand);
+        } else {
+            return {};
+        }
+
+        arg_start = arg_end + 1;
+    }
+
+    return ssa::Operand::from_branch_target(target, type);
+}
+
+std::optional<ssa::Operand> SSAParser::parse_value(const std::string &string, ssa::Type type) {
+    if (string[0] == '-' || LineBasedReader::is_numeric(string[0])) {
+        if (string.find('.') == std::string::npos) {
+            return ssa::Operand::from_int_immediate(LargeInt{string}, type);
+        } else {
+            return ssa::Operand::from_fp_immediate(std::stod(string), type);
+        }
+    } else if (string[0] == '%') {
+        unsigned reg_number = std::stoul(string.substr(1));
+        ssa::VirtualRegister reg = static_cast<ssa::VirtualRegister>(reg_number);
+        return ssa::Operand::from_register(reg, type);
+    } else {
+        return {};
+    }
+}
+
 } // namespace test
 } // namespace banjo
@@ -30,11 +30,15 @@ private:
     std::string parse_identifier();
     ssa::Type parse_type();
     std::vector<ssa::Type> parse_params();
+    std::string parse_block_label();
+    void parse_block_params(ssa::BasicBlock &block);
 
     ssa::Instruction parse_instr(std::optional<ssa::VirtualRegister> dst);
     ssa::Opcode parse_op();
-    std::vector<ssa::Operand> parse_operands();
+    ssa::Instruction::OperandList parse_operands();
     std::optional<ssa::Operand> parse_operand();
+    std::optional<ssa::Operand> parse_branch_target(const std::string &string, ssa::Type type);
+    std::optional<ssa::Operand> parse_value(const std::string &string, ssa::Type type);
 };
 
 } // namespace test
@@ -1,6 +1,7 @@
 #include "ssa_util.hpp"
 
 #include "banjo/passes/inlining_pass.hpp"
+#include "banjo/passes/loop_vectorizer_pass.hpp"
 #include "banjo/passes/peephole_optimizer.hpp"
 #include "banjo/passes/sroa_pass.hpp"
 #include "banjo/passes/stack_to_reg_pass.hpp"
@@ -35,6 +36,8 @@ void SSAUtil::optimize(std::string_view pass_name) {
         passes::StackToRegPass(target).run(ssa_mod);
     } else if (pass_name == "inlining") {
         passes::InliningPass(target).run(ssa_mod);
+    } else if (pass_name == "loop_vectorizer") {
+        passes::LoopVectorizerPass(target).run(ssa_mod);
     } else {
         ASSERT_UNREACHABLE;
     }
@@ -51,6 +54,11 @@ void SSAUtil::renumber_regs(ssa::Module &mod) {
 
     for (ssa::Function *func : mod.get_functions()) {
         for (ssa::BasicBlock &block : *func) {
+            for (ssa::VirtualRegister param_reg : block.get_param_regs()) {
+                reg_map.insert({param_reg, next_reg});
+                next_reg += 1;
+            }
+
             for (ssa::Instruction &instr : block) {
                 if (instr.get_dest()) {
                     reg_map.insert({*instr.get_dest(), next_reg});
@@ -62,6 +70,10 @@ void SSAUtil::renumber_regs(ssa::Module &mod) {
 
     for (ssa::Function *func : mod.get_functions()) {
         for (ssa::BasicBlock &block : *func) {
+            for (ssa::VirtualRegister &param_reg : block.get_param_regs()) {
+                param_reg = reg_map.at(param_reg);
+            }
+
             for (ssa::Instruction &instr : block) {
                 if (instr.get_dest()) {
                     instr.set_dest(reg_map.at(*instr.get_dest()));
@@ -139,6 +139,9 @@ enum ASTNodeType : std::uint8_t {
     AST_U64,
     AST_F32,
     AST_F64,
+    AST_F32X4,
+    AST_F64X2,
+    AST_I32X4,
     AST_USIZE,
     AST_BOOL,
     AST_ADDR,
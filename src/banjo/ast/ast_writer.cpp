@@ -168,6 +168,9 @@ const char *ASTWriter::get_type_name(ASTNodeType type) {
         case AST_U64: return "U64";
         case AST_F32: return "F32";
         case AST_F64: return "F64";
+        case AST_F32X4: return "F32X4";
+        case AST_F64X2: return "F64X2";
+        case AST_I32X4: return "I32X4";
         case AST_USIZE: return "USIZE";
         case AST_BOOL: return "BOOL";
         case AST_ADDR: return "ADDR";
@@ -0,0 +1,357 @@
+#include "build_cache.hpp"
+
+#include "banjo/codegen/fragment_serializer.hpp"
+#include "banjo/utils/timing.hpp"
+#include "banjo/utils/utils.hpp"
+#include "banjo/utils/write_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace banjo::codegen {
+
+static constexpr std::uint32_t ENTRY_MAGIC = 0x434A4E42; // "BNJC"
+static constexpr std::uint32_t ENTRY_VERSION = 1;
+static constexpr std::size_t ENTRY_HEADER_SIZE = 16;
+
+void BuildCache::Hasher::write(const void *data, std::size_t size) {
+    // FNV-1a, which is stable across platforms and compiler builds unlike `std::hash`.
+    const std::uint8_t *bytes = static_cast<const std::uint8_t *>(data);
+
+    for (std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3;
+    }
+}
+
+void BuildCache::Hasher::write_u64(std::uint64_t value) {
+    write(&value, sizeof(value));
+}
+
+void BuildCache::Hasher::write_string(std::string_view string) {
+    write_u64(string.size());
+    write(string.data(), string.size());
+}
+
+std::uint64_t BuildCache::hash_string(std::string_view string) {
+    Hasher hasher;
+    hasher.write_string(string);
+    return hasher.get();
+}
+
+BuildCache::BuildCache(Settings settings) : settings{std::move(settings)} {}
+
+void BuildCache::begin_module(ssa::Module &mod) {
+    // External declarations are shared by all functions and change rarely, so they are part of
+    // every key instead of being tracked per function.
+
+    Hasher hasher;
+
+    for (ssa::FunctionDecl *external_func : mod.get_external_functions()) {
+        hash_func_decl(hasher, external_func->name, external_func->type);
+    }
+
+    for (ssa::GlobalDecl *external_global : mod.get_external_globals()) {
+        hasher.write_string(external_global->name);
+        hash_type(hasher, external_global->type);
+    }
+
+    if (mod.get_addr_table()) {
+        for (const std::string &entry : mod.get_addr_table()->get_entries()) {
+            hasher.write_string(entry);
+        }
+    }
+
+    module_hash = hasher.get();
+}
+
+std::uint64_t BuildCache::compute_key(ssa::Function &func) {
+    Hasher hasher;
+    hasher.write_u64(settings.settings_hash);
+    hasher.write_u64(module_hash);
+
+    hash_func_decl(hasher, func.name, func.type);
+    hasher.write_u64(func.global);
+
+    for (ssa::BasicBlock &block : func) {
+        hash_block(hasher, block);
+    }
+
+    return hasher.get();
+}
+
+std::optional<mcode::Module> BuildCache::load(std::uint64_t key, mcode::CallingConvention *calling_conv) {
+    std::filesystem::path path = get_entry_path(key);
+    std::ifstream stream(path, std::ios::binary);
+
+    if (!stream) {
+        num_misses += 1;
+        return {};
+    }
+
+    std::vector<std::uint8_t> data{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    stream.close();
+
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t stored_key;
+
+    if (data.size() < ENTRY_HEADER_SIZE) {
+        num_misses += 1;
+        return {};
+    }
+
+    std::memcpy(&magic, &data[0], 4);
+    std::memcpy(&version, &data[4], 4);
+    std::memcpy(&stored_key, &data[8], 8);
+
+    if (magic != ENTRY_MAGIC || version != ENTRY_VERSION || stored_key != key) {
+        num_misses += 1;
+        return {};
+    }
+
+    data.erase(data.begin(), data.begin() + ENTRY_HEADER_SIZE);
+    std::optional<mcode::Module> fragment = FragmentReader(data).read(calling_conv);
+
+    if (!fragment) {
+        num_misses += 1;
+        return {};
+    }
+
+    // The modification time is used to find the least recently used entries during eviction.
+    std::error_code error_code;
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error_code);
+
+    num_hits += 1;
+    return fragment;
+}
+
+void BuildCache::store(std::uint64_t key, mcode::Module &fragment) {
+    std::optional<std::vector<std::uint8_t>> payload = FragmentWriter().write(fragment);
+    if (!payload) {
+        return;
+    }
+
+    WriteBuffer header;
+    header.write_u32(ENTRY_MAGIC);
+    header.write_u32(ENTRY_VERSION);
+    header.write_u64(key);
+
+    std::filesystem::path path = get_entry_path(key);
+    std::error_code error_code;
+    std::filesystem::create_directories(path.parent_path(), error_code);
+
+    // Entries are written to a temporary file first and then renamed so that concurrent builds
+    // never see partially written entries.
+    std::size_t thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    std::filesystem::path tmp_path = path;
+    tmp_path += ".tmp" + std::to_string(thread_hash);
+
+    std::ofstream stream(tmp_path, std::ios::binary);
+    if (!stream) {
+        return;
+    }
+
+    stream.write(reinterpret_cast<const char *>(header.get_data().data()), header.get_size());
+    stream.write(reinterpret_cast<const char *>(payload->data()), payload->size());
+    stream.close();
+
+    std::filesystem::rename(tmp_path, path, error_code);
+
+    if (error_code) {
+        std::filesystem::remove(tmp_path, error_code);
+        return;
+    }
+
+    num_stores += 1;
+}
+
+void BuildCache::evict() {
+    PROFILE_SCOPE("build cache eviction");
+
+    struct Entry {
+        std::filesystem::path path;
+        std::uint64_t size;
+        std::filesystem::file_time_type last_use;
+    };
+
+    std::vector<Entry> entries;
+    size = 0;
+
+    std::error_code error_code;
+    std::filesystem::recursive_directory_iterator iter(settings.dir, error_code);
+
+    for (; !error_code && iter != std::filesystem::recursive_directory_iterator(); iter.increment(error_code)) {
+        if (!iter->is_regular_file(error_code)) {
+            continue;
+        }
+
+        std::uint64_t entry_size = iter->file_size(error_code);
+        std::filesystem::file_time_type last_use = iter->last_write_time(error_code);
+        entries.push_back(Entry{iter->path(), entry_size, last_use});
+        size += entry_size;
+    }
+
+    if (size > settings.size_limit) {
+        std::sort(entries.begin(), entries.end(), [](const Entry &lhs, const Entry &rhs) {
+            return lhs.last_use < rhs.last_use;
+        });
+
+        for (const Entry &entry : entries) {
+            if (size <= settings.size_limit) {
+                break;
+            }
+
+            if (std::filesystem::remove(entry.path, error_code)) {
+                size -= entry.size;
+                num_evictions += 1;
+            }
+        }
+    }
+
+    num_entries = entries.size() - num_evictions;
+}
+
+BuildCache::Stats BuildCache::get_stats() {
+    return Stats{
+        .num_hits = num_hits,
+        .num_misses = num_misses,
+        .num_stores = num_stores,
+        .num_evictions = num_evictions,
+        .num_entries = num_entries,
+        .size = size,
+    };
+}
+
+std::filesystem::path BuildCache::get_entry_path(std::uint64_t key) {
+    std::string name = utils::to_hex_string(key, 16);
+    return settings.dir / name.substr(0, 2) / name.substr(2);
+}
+
+void BuildCache::hash_func_decl(Hasher &hasher, const std::string &name, ssa::FunctionType &type) {
+    hasher.write_string(name);
+    hasher.write_u64(static_cast<std::uint64_t>(type.calling_conv));
+    hasher.write_u64(type.variadic);
+    hasher.write_u64(type.variadic ? type.first_variadic_index : 0);
+    hash_type(hasher, type.return_type);
+    hasher.write_u64(type.params.size());
+
+    for (ssa::Type param : type.params) {
+        hash_type(hasher, param);
+    }
+}
+
+void BuildCache::hash_block(Hasher &hasher, ssa::BasicBlock &block) {
+    hasher.write_string(block.get_label());
+    hasher.write_u64(block.get_param_regs().size());
+
+    for (unsigned i = 0; i < block.get_param_regs().size(); i++) {
+        hasher.write_u64(block.get_param_regs()[i]);
+        hash_type(hasher, block.get_param_types()[i]);
+    }
+
+    hasher.write_u64(block.get_instrs().get_size());
+
+    for (ssa::Instruction &instr : block) {
+        hasher.write_u64(static_cast<std::uint64_t>(instr.get_opcode()));
+        hasher.write_u64(instr.get_dest() ? *instr.get_dest() + 1 : 0);
+        hasher.write_u64(static_cast<std::uint64_t>(instr.get_attr()));
+
+        // The attribute data is only initialized for variadic calls.
+        if (instr.get_attr() == ssa::Instruction::Attribute::VARIADIC) {
+            hasher.write_u64(instr.get_attr_data());
+        }
+
+        hasher.write_u64(instr.get_operands().size());
+
+        for (ssa::Operand &operand : instr.get_operands()) {
+            hash_operand(hasher, operand);
+        }
+    }
+}
+
+void BuildCache::hash_operand(Hasher &hasher, ssa::Operand &operand) {
+    hash_type(hasher, operand.get_type());
+
+    // Symbols are hashed together with their declarations because the lowering of references
+    // depends on the types of the referenced functions and globals.
+
+    if (operand.is_int_immediate()) {
+        LargeInt value = operand.get_int_immediate();
+        hasher.write_u64(0);
+        hasher.write_u64(value.get_magnitude());
+        hasher.write_u64(value.is_negative());
+    } else if (operand.is_fp_immediate()) {
+        double value = operand.get_fp_immediate();
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        hasher.write_u64(1);
+        hasher.write_u64(bits);
+    } else if (operand.is_register()) {
+        hasher.write_u64(2);
+        hasher.write_u64(operand.get_register());
+    } else if (operand.is_func()) {
+        ssa::Function *func = operand.get_func();
+        hasher.write_u64(3);
+        hash_func_decl(hasher, func->name, func->type);
+        hasher.write_u64(func->global);
+    } else if (operand.is_global()) {
+        ssa::Global *global = operand.get_global();
+        hasher.write_u64(4);
+        hasher.write_string(global->name);
+        hash_type(hasher, global->type);
+        hasher.write_u64(global->external);
+    } else if (operand.is_extern_func()) {
+        ssa::FunctionDecl *extern_func = operand.get_extern_func();
+        hasher.write_u64(5);
+        hash_func_decl(hasher, extern_func->name, extern_func->type);
+    } else if (operand.is_extern_global()) {
+        ssa::GlobalDecl *extern_global = operand.get_extern_global();
+        hasher.write_u64(6);
+        hasher.write_string(extern_global->name);
+        hash_type(hasher, extern_global->type);
+    } else if (operand.is_branch_target()) {
+        ssa::BranchTarget &branch_target = operand.get_branch_target();
+        hasher.write_u64(7);
+        hasher.write_string(branch_target.block->get_label());
+        hasher.write_u64(branch_target.args.size());
+
+        for (ssa::Operand &arg : branch_target.args) {
+            hash_operand(hasher, arg);
+        }
+    } else if (operand.is_comparison()) {
+        hasher.write_u64(8);
+        hasher.write_u64(static_cast<std::uint64_t>(operand.get_comparison()));
+    } else if (operand.is_type()) {
+        hasher.write_u64(9);
+    } else if (operand.is_undef()) {
+        hasher.write_u64(10);
+    }
+}
+
+void BuildCache::hash_type(Hasher &hasher, ssa::Type type) {
+    hasher.write_u64(type.get_array_length());
+
+    if (type.is_primitive()) {
+        hasher.write_u64(static_cast<std::uint64_t>(type.get_primitive()));
+        return;
+    }
+
+    // Struct types are hashed by layout because member offsets are computed during lowering.
+    ssa::Structure *struct_ = type.get_struct();
+    hasher.write_string(struct_->name);
+    hasher.write_u64(struct_->is_union);
+    hasher.write_u64(struct_->members.size());
+
+    for (const ssa::StructureMember &member : struct_->members) {
+        hash_type(hasher, member.type);
+    }
+}
+
+} // namespace banjo::codegen
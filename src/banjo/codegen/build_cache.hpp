@@ -0,0 +1,89 @@
+#ifndef BANJO_CODEGEN_BUILD_CACHE_H
+#define BANJO_CODEGEN_BUILD_CACHE_H
+
+#include "banjo/mcode/calling_convention.hpp"
+#include "banjo/mcode/module.hpp"
+#include "banjo/ssa/function.hpp"
+#include "banjo/ssa/module.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace banjo::codegen {
+
+// Persistent on-disk cache for the machine code of functions. Entries are keyed by a hash of the
+// optimized SSA of a function, the declarations of everything it references, and the compilation
+// settings, so unchanged functions can skip the backend in subsequent builds. Least recently used
+// entries are evicted once the cache grows beyond its size limit.
+class BuildCache {
+
+public:
+    struct Settings {
+        std::filesystem::path dir;
+        std::uint64_t size_limit;
+
+        // Hash of everything outside of the SSA module that affects code generation, like the
+        // target and the optimization level.
+        std::uint64_t settings_hash;
+    };
+
+    struct Stats {
+        unsigned num_hits;
+        unsigned num_misses;
+        unsigned num_stores;
+        unsigned num_evictions;
+        unsigned num_entries;
+        std::uint64_t size;
+    };
+
+private:
+    class Hasher {
+
+    private:
+        std::uint64_t hash = 0xCBF29CE484222325;
+
+    public:
+        void write(const void *data, std::size_t size);
+        void write_u64(std::uint64_t value);
+        void write_string(std::string_view string);
+        std::uint64_t get() const { return hash; }
+    };
+
+    Settings settings;
+    std::uint64_t module_hash = 0;
+
+    std::atomic<unsigned> num_hits = 0;
+    std::atomic<unsigned> num_misses = 0;
+    std::atomic<unsigned> num_stores = 0;
+    unsigned num_evictions = 0;
+    unsigned num_entries = 0;
+    std::uint64_t size = 0;
+
+public:
+    static std::uint64_t hash_string(std::string_view string);
+
+    BuildCache(Settings settings);
+
+    void begin_module(ssa::Module &mod);
+    std::uint64_t compute_key(ssa::Function &func);
+    std::optional<mcode::Module> load(std::uint64_t key, mcode::CallingConvention *calling_conv);
+    void store(std::uint64_t key, mcode::Module &fragment);
+    void evict();
+
+    Stats get_stats();
+
+private:
+    std::filesystem::path get_entry_path(std::uint64_t key);
+
+    void hash_func_decl(Hasher &hasher, const std::string &name, ssa::FunctionType &type);
+    void hash_block(Hasher &hasher, ssa::BasicBlock &block);
+    void hash_operand(Hasher &hasher, ssa::Operand &operand);
+    void hash_type(Hasher &hasher, ssa::Type type);
+};
+
+} // namespace banjo::codegen
+
+#endif
@@ -0,0 +1,490 @@
+#include "fragment_serializer.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace banjo::codegen {
+
+namespace OperandTag {
+enum : std::uint8_t {
+    INT_IMMEDIATE,
+    FP_IMMEDIATE,
+    REGISTER,
+    STACK_SLOT,
+    SYMBOL,
+    BASIC_BLOCK,
+    SYMBOL_DEREF,
+    X86_64_ADDR,
+    STACK_OFFSET,
+};
+}
+
+namespace GlobalTag {
+enum : std::uint8_t {
+    NONE,
+    INTEGER,
+    FLOATING_POINT,
+    BYTES,
+    STRING,
+    SYMBOL_REF,
+};
+}
+
+std::optional<std::vector<std::uint8_t>> FragmentWriter::write(mcode::Module &fragment) {
+    buffer.write_u32(fragment.get_functions().size());
+
+    for (mcode::Function *func : fragment.get_functions()) {
+        write_func(*func);
+    }
+
+    buffer.write_u32(fragment.get_globals().size());
+
+    for (mcode::Global &global : fragment.get_globals()) {
+        write_global(global);
+    }
+
+    buffer.write_u32(fragment.get_global_symbols().size());
+
+    for (const std::string &global_symbol : fragment.get_global_symbols()) {
+        write_string(global_symbol);
+    }
+
+    if (!valid) {
+        return {};
+    }
+
+    return buffer.move_data();
+}
+
+void FragmentWriter::write_func(mcode::Function &func) {
+    write_string(func.get_name());
+    write_stack_frame(func.get_stack_frame());
+    buffer.write_u32(func.get_unwind_info().alloc_size);
+
+    // The labels of all blocks are written first so branches can refer to blocks that come later.
+    block_indices.clear();
+    buffer.write_u32(func.get_basic_blocks().get_size());
+
+    for (mcode::BasicBlock &block : func) {
+        block_indices.insert({&block, block_indices.size()});
+        write_string(block.get_label());
+    }
+
+    for (mcode::BasicBlock &block : func) {
+        buffer.write_u32(block.get_instrs().get_size());
+
+        for (mcode::Instruction &instr : block) {
+            write_instr(instr);
+        }
+    }
+}
+
+void FragmentWriter::write_stack_frame(mcode::StackFrame &stack_frame) {
+    buffer.write_u32(stack_frame.get_stack_slots().size());
+
+    for (mcode::StackSlot &slot : stack_frame.get_stack_slots()) {
+        buffer.write_u8(static_cast<std::uint8_t>(slot.get_type()));
+        buffer.write_i32(slot.get_size());
+        buffer.write_i32(slot.get_alignment());
+        buffer.write_i32(slot.get_offset());
+        buffer.write_i32(slot.get_type() == mcode::StackSlot::Type::CALL_ARG ? slot.get_call_arg_index() : 0);
+    }
+
+    buffer.write_u32(stack_frame.get_call_arg_slot_indices().size());
+
+    for (int index : stack_frame.get_call_arg_slot_indices()) {
+        buffer.write_i32(index);
+    }
+
+    buffer.write_u32(stack_frame.get_reg_save_slot_indices().size());
+
+    for (unsigned index : stack_frame.get_reg_save_slot_indices()) {
+        buffer.write_u32(index);
+    }
+
+    buffer.write_i32(stack_frame.get_size());
+    buffer.write_i32(stack_frame.get_total_size());
+}
+
+void FragmentWriter::write_instr(mcode::Instruction &instr) {
+    buffer.write_i32(instr.get_opcode());
+    buffer.write_u32(instr.get_flags());
+    buffer.write_u32(instr.get_operands().size());
+
+    for (mcode::Operand &operand : instr.get_operands()) {
+        write_operand(operand);
+    }
+}
+
+void FragmentWriter::write_operand(mcode::Operand &operand) {
+    buffer.write_i32(operand.get_size());
+
+    if (operand.is_int_immediate()) {
+        buffer.write_u8(OperandTag::INT_IMMEDIATE);
+        write_large_int(operand.get_int_immediate());
+    } else if (operand.is_fp_immediate()) {
+        buffer.write_u8(OperandTag::FP_IMMEDIATE);
+        buffer.write_f64(operand.get_fp_immediate());
+    } else if (operand.is_register()) {
+        buffer.write_u8(OperandTag::REGISTER);
+        buffer.write_u32(operand.get_register().internal_value());
+    } else if (operand.is_stack_slot()) {
+        buffer.write_u8(OperandTag::STACK_SLOT);
+        buffer.write_u32(operand.get_stack_slot());
+    } else if (operand.is_symbol()) {
+        buffer.write_u8(OperandTag::SYMBOL);
+        write_symbol(operand.get_symbol());
+    } else if (operand.is_basic_block()) {
+        auto iter = block_indices.find(&operand.get_basic_block());
+
+        if (iter == block_indices.end()) {
+            valid = false;
+            return;
+        }
+
+        buffer.write_u8(OperandTag::BASIC_BLOCK);
+        buffer.write_u32(iter->second);
+    } else if (operand.is_symbol_deref()) {
+        buffer.write_u8(OperandTag::SYMBOL_DEREF);
+        write_symbol(operand.get_deref_symbol());
+    } else if (operand.is_x86_64_addr()) {
+        buffer.write_u8(OperandTag::X86_64_ADDR);
+        write_x86_64_addr(operand.get_x86_64_addr());
+    } else if (operand.is_stack_offset()) {
+        buffer.write_u8(OperandTag::STACK_OFFSET);
+        buffer.write_u32(operand.get_stack_offset().slot);
+        buffer.write_u32(operand.get_stack_offset().offset);
+    } else {
+        valid = false;
+    }
+}
+
+void FragmentWriter::write_x86_64_addr(const target::X8664Address &addr) {
+    if (addr.is_base_reg()) {
+        buffer.write_u8(0);
+        buffer.write_u32(addr.get_base_reg().internal_value());
+    } else {
+        buffer.write_u8(1);
+        write_symbol(addr.get_base_symbol());
+    }
+
+    if (addr.has_offset_imm()) {
+        buffer.write_u8(0);
+        buffer.write_i32(addr.get_offset_imm());
+    } else {
+        buffer.write_u8(1);
+        buffer.write_u32(addr.get_offset_stack_addr().slot);
+        buffer.write_u32(addr.get_offset_stack_addr().offset);
+    }
+
+    if (addr.has_offset_reg()) {
+        buffer.write_u8(1);
+        buffer.write_u32(addr.get_offset_reg().reg.internal_value());
+        buffer.write_u32(addr.get_offset_reg().scale);
+    } else {
+        buffer.write_u8(0);
+    }
+}
+
+void FragmentWriter::write_global(mcode::Global &global) {
+    write_string(global.name);
+    buffer.write_u32(global.size);
+    buffer.write_u32(global.alignment);
+
+    if (std::holds_alternative<mcode::Global::None>(global.value)) {
+        buffer.write_u8(GlobalTag::NONE);
+    } else if (auto integer = std::get_if<mcode::Global::Integer>(&global.value)) {
+        buffer.write_u8(GlobalTag::INTEGER);
+        write_large_int(*integer);
+    } else if (auto fp = std::get_if<mcode::Global::FloatingPoint>(&global.value)) {
+        buffer.write_u8(GlobalTag::FLOATING_POINT);
+        buffer.write_f64(*fp);
+    } else if (auto bytes = std::get_if<mcode::Global::Bytes>(&global.value)) {
+        buffer.write_u8(GlobalTag::BYTES);
+        buffer.write_u32(bytes->size());
+        buffer.write_data(bytes->data(), bytes->size());
+    } else if (auto string = std::get_if<mcode::Global::String>(&global.value)) {
+        buffer.write_u8(GlobalTag::STRING);
+        write_string(*string);
+    } else if (auto symbol_ref = std::get_if<mcode::Global::SymbolRef>(&global.value)) {
+        buffer.write_u8(GlobalTag::SYMBOL_REF);
+        write_string(symbol_ref->name);
+    }
+}
+
+void FragmentWriter::write_symbol(const mcode::Symbol &symbol) {
+    write_string(symbol.name);
+    buffer.write_u8(static_cast<std::uint8_t>(symbol.reloc));
+}
+
+void FragmentWriter::write_large_int(LargeInt value) {
+    buffer.write_u64(value.get_magnitude());
+    buffer.write_u8(value.is_negative());
+}
+
+void FragmentWriter::write_string(const std::string &string) {
+    buffer.write_u32(string.size());
+    buffer.write_data(string.data(), string.size());
+}
+
+FragmentReader::FragmentReader(const std::vector<std::uint8_t> &data) : data{data} {}
+
+std::optional<mcode::Module> FragmentReader::read(mcode::CallingConvention *calling_conv) {
+    mcode::Module fragment;
+
+    std::uint32_t num_funcs = read_u32();
+
+    for (std::uint32_t i = 0; i < num_funcs && valid; i++) {
+        fragment.add(read_func(calling_conv));
+    }
+
+    std::uint32_t num_globals = read_u32();
+
+    for (std::uint32_t i = 0; i < num_globals && valid; i++) {
+        fragment.add(read_global());
+    }
+
+    std::uint32_t num_global_symbols = read_u32();
+
+    for (std::uint32_t i = 0; i < num_global_symbols && valid; i++) {
+        fragment.add_global_symbol(read_string());
+    }
+
+    if (!valid || position != data.size()) {
+        return {};
+    }
+
+    return fragment;
+}
+
+mcode::Function *FragmentReader::read_func(mcode::CallingConvention *calling_conv) {
+    mcode::Function *func = new mcode::Function(read_string(), calling_conv);
+    read_stack_frame(func->get_stack_frame());
+    func->get_unwind_info().alloc_size = read_u32();
+
+    std::uint32_t num_blocks = read_u32();
+    blocks.clear();
+
+    for (std::uint32_t i = 0; i < num_blocks && valid; i++) {
+        mcode::BasicBlockIter block = func->get_basic_blocks().append(mcode::BasicBlock(read_string(), func));
+        blocks.push_back(&*block);
+    }
+
+    for (mcode::BasicBlock &block : *func) {
+        std::uint32_t num_instrs = read_u32();
+
+        for (std::uint32_t i = 0; i < num_instrs && valid; i++) {
+            block.append(read_instr());
+        }
+    }
+
+    return func;
+}
+
+void FragmentReader::read_stack_frame(mcode::StackFrame &stack_frame) {
+    std::uint32_t num_slots = read_u32();
+
+    for (std::uint32_t i = 0; i < num_slots && valid; i++) {
+        mcode::StackSlot::Type type = static_cast<mcode::StackSlot::Type>(read_u8());
+        int size = read_i32();
+        int alignment = read_i32();
+
+        mcode::StackSlot slot(type, size, alignment);
+        slot.set_offset(read_i32());
+        slot.set_call_arg_index(read_i32());
+        stack_frame.get_stack_slots().push_back(slot);
+    }
+
+    std::uint32_t num_call_arg_slots = read_u32();
+
+    for (std::uint32_t i = 0; i < num_call_arg_slots && valid; i++) {
+        stack_frame.get_call_arg_slot_indices().push_back(read_i32());
+    }
+
+    std::uint32_t num_reg_save_slots = read_u32();
+
+    for (std::uint32_t i = 0; i < num_reg_save_slots && valid; i++) {
+        stack_frame.get_reg_save_slot_indices().push_back(read_u32());
+    }
+
+    stack_frame.set_size(read_i32());
+    stack_frame.set_total_size(read_i32());
+}
+
+mcode::Instruction FragmentReader::read_instr() {
+    mcode::Opcode opcode = read_i32();
+    unsigned flags = read_u32();
+    std::uint32_t num_operands = read_u32();
+
+    mcode::Instruction::OperandList operands;
+
+    for (std::uint32_t i = 0; i < num_operands && valid; i++) {
+        operands.push_back(read_operand());
+    }
+
+    return mcode::Instruction(opcode, std::move(operands), flags);
+}
+
+mcode::Operand FragmentReader::read_operand() {
+    int size = read_i32();
+
+    switch (read_u8()) {
+        case OperandTag::INT_IMMEDIATE: return mcode::Operand::from_int_immediate(read_large_int(), size);
+        case OperandTag::FP_IMMEDIATE: return mcode::Operand::from_fp_immediate(read_f64(), size);
+        case OperandTag::REGISTER: return mcode::Operand::from_register(read_register(), size);
+        case OperandTag::STACK_SLOT: return mcode::Operand::from_stack_slot(read_u32(), size);
+        case OperandTag::SYMBOL: return mcode::Operand::from_symbol(read_symbol(), size);
+        case OperandTag::SYMBOL_DEREF: return mcode::Operand::from_symbol_deref(read_symbol(), size);
+        case OperandTag::X86_64_ADDR: return mcode::Operand::from_x86_64_addr(read_x86_64_addr(), size);
+        case OperandTag::BASIC_BLOCK: {
+            std::uint32_t index = read_u32();
+
+            if (index >= blocks.size()) {
+                valid = false;
+                return {};
+            }
+
+            return mcode::Operand::from_basic_block(*blocks[index], size);
+        }
+        case OperandTag::STACK_OFFSET: {
+            mcode::StackSlotID slot = read_u32();
+            unsigned offset = read_u32();
+            return mcode::Operand::from_stack_offset(mcode::StackAddress(slot, offset), size);
+        }
+        default: valid = false; return {};
+    }
+}
+
+target::X8664Address FragmentReader::read_x86_64_addr() {
+    target::X8664Address addr;
+
+    if (read_u8() == 0) {
+        addr.base = read_register();
+    } else {
+        addr.base = read_symbol();
+    }
+
+    if (read_u8() == 0) {
+        addr.offset_const = read_i32();
+    } else {
+        mcode::StackSlotID slot = read_u32();
+        unsigned offset = read_u32();
+        addr.offset_const = mcode::StackAddress(slot, offset);
+    }
+
+    if (read_u8() == 1) {
+        mcode::Register reg = read_register();
+        unsigned scale = read_u32();
+        addr.offset_reg = target::X8664Address::RegOffset(reg, scale);
+    }
+
+    return addr;
+}
+
+mcode::Global FragmentReader::read_global() {
+    mcode::Global global;
+    global.name = read_string();
+    global.size = read_u32();
+    global.alignment = read_u32();
+
+    switch (read_u8()) {
+        case GlobalTag::NONE: global.value = mcode::Global::None{}; break;
+        case GlobalTag::INTEGER: global.value = read_large_int(); break;
+        case GlobalTag::FLOATING_POINT: global.value = read_f64(); break;
+        case GlobalTag::BYTES: {
+            std::uint32_t size = read_u32();
+
+            if (position + size > data.size()) {
+                valid = false;
+                break;
+            }
+
+            global.value = mcode::Global::Bytes(data.begin() + position, data.begin() + position + size);
+            position += size;
+            break;
+        }
+        case GlobalTag::STRING: global.value = read_string(); break;
+        case GlobalTag::SYMBOL_REF: global.value = mcode::Global::SymbolRef{read_string()}; break;
+        default: valid = false; break;
+    }
+
+    return global;
+}
+
+mcode::Register FragmentReader::read_register() {
+    std::uint32_t value = read_u32();
+
+    if (value & 1) {
+        return mcode::Register::from_physical(value >> 1);
+    } else {
+        return mcode::Register::from_virtual(value >> 1);
+    }
+}
+
+mcode::Symbol FragmentReader::read_symbol() {
+    std::string name = read_string();
+    mcode::Relocation reloc = static_cast<mcode::Relocation>(read_u8());
+    return mcode::Symbol(std::move(name), reloc);
+}
+
+LargeInt FragmentReader::read_large_int() {
+    std::uint64_t magnitude = read_u64();
+    bool negative = read_u8() != 0;
+    return LargeInt(magnitude, negative);
+}
+
+std::string FragmentReader::read_string() {
+    std::uint32_t size = read_u32();
+
+    if (position + size > data.size()) {
+        valid = false;
+        return "";
+    }
+
+    std::string string(reinterpret_cast<const char *>(&data[position]), size);
+    position += size;
+    return string;
+}
+
+std::uint8_t FragmentReader::read_u8() {
+    if (position + 1 > data.size()) {
+        valid = false;
+        return 0;
+    }
+
+    return data[position++];
+}
+
+std::uint32_t FragmentReader::read_u32() {
+    std::uint32_t value = 0;
+
+    for (unsigned i = 0; i < 4; i++) {
+        value |= static_cast<std::uint32_t>(read_u8()) << (8 * i);
+    }
+
+    return value;
+}
+
+std::int32_t FragmentReader::read_i32() {
+    std::uint32_t value = read_u32();
+    return reinterpret_cast<std::int32_t &>(value);
+}
+
+std::uint64_t FragmentReader::read_u64() {
+    std::uint64_t value = 0;
+
+    for (unsigned i = 0; i < 8; i++) {
+        value |= static_cast<std::uint64_t>(read_u8()) << (8 * i);
+    }
+
+    return value;
+}
+
+double FragmentReader::read_f64() {
+    std::uint64_t bits = read_u64();
+    double value;
+    std::memcpy(&value, &bits, sizeof(double));
+    return value;
+}
+
+} // namespace banjo::codegen
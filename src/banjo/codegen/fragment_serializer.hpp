@@ -0,0 +1,75 @@
+#ifndef BANJO_CODEGEN_FRAGMENT_SERIALIZER_H
+#define BANJO_CODEGEN_FRAGMENT_SERIALIZER_H
+
+#include "banjo/mcode/calling_convention.hpp"
+#include "banjo/mcode/module.hpp"
+#include "banjo/utils/write_buffer.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace banjo::codegen {
+
+// Converts the fragment modules produced by the backend for single functions to a binary
+// representation and back. Only the state that is still needed by the emitters after all machine
+// passes have run is preserved. Fragments containing operands that cannot be serialized yet
+// (AArch64 operands) are rejected.
+class FragmentWriter {
+
+private:
+    WriteBuffer buffer;
+    std::unordered_map<mcode::BasicBlock *, unsigned> block_indices;
+    bool valid = true;
+
+public:
+    std::optional<std::vector<std::uint8_t>> write(mcode::Module &fragment);
+
+private:
+    void write_func(mcode::Function &func);
+    void write_stack_frame(mcode::StackFrame &stack_frame);
+    void write_instr(mcode::Instruction &instr);
+    void write_operand(mcode::Operand &operand);
+    void write_x86_64_addr(const target::X8664Address &addr);
+    void write_global(mcode::Global &global);
+    void write_symbol(const mcode::Symbol &symbol);
+    void write_large_int(LargeInt value);
+    void write_string(const std::string &string);
+};
+
+class FragmentReader {
+
+private:
+    const std::vector<std::uint8_t> &data;
+    std::size_t position = 0;
+    std::vector<mcode::BasicBlock *> blocks;
+    bool valid = true;
+
+public:
+    FragmentReader(const std::vector<std::uint8_t> &data);
+    std::optional<mcode::Module> read(mcode::CallingConvention *calling_conv);
+
+private:
+    mcode::Function *read_func(mcode::CallingConvention *calling_conv);
+    void read_stack_frame(mcode::StackFrame &stack_frame);
+    mcode::Instruction read_instr();
+    mcode::Operand read_operand();
+    target::X8664Address read_x86_64_addr();
+    mcode::Global read_global();
+    mcode::Register read_register();
+    mcode::Symbol read_symbol();
+    LargeInt read_large_int();
+    std::string read_string();
+
+    std::uint8_t read_u8();
+    std::uint32_t read_u32();
+    std::int32_t read_i32();
+    std::uint64_t read_u64();
+    double read_f64();
+};
+
+} // namespace banjo::codegen
+
+#endif
@@ -0,0 +1,70 @@
+#include "live_interval_union.hpp"
+
+#include "banjo/utils/macros.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace banjo {
+
+namespace codegen {
+
+bool LiveIntervalUnion::overlaps(unsigned start, unsigned end) const {
+    // Because intervals don't overlap, the interval with the latest start point before the end of
+    // the query also has the latest end point of all intervals starting before it.
+    auto iter = find_last_starting_before(end);
+    return iter != intervals.end() && iter->second.end >= start;
+}
+
+std::optional<unsigned> LiveIntervalUnion::find_containing(unsigned start, unsigned end) const {
+    auto iter = find_last_starting_before(start);
+
+    if (iter != intervals.end() && iter->second.end >= end) {
+        return iter->second.owner;
+    } else {
+        return {};
+    }
+}
+
+void LiveIntervalUnion::insert(unsigned start, unsigned end, unsigned owner) {
+    ASSERT(!overlaps(start, end));
+    intervals.insert({start, Interval{.end = end, .owner = owner}});
+}
+
+void LiveIntervalUnion::insert_reserved(unsigned start, unsigned end) {
+    // Reserved intervals may overlap each other, so they are merged with all intervals they touch.
+    auto iter = find_last_starting_before(start);
+
+    if (iter == intervals.end() || iter->second.end < start) {
+        iter = intervals.lower_bound(start);
+    }
+
+    while (iter != intervals.end() && iter->first <= end) {
+        ASSERT(iter->second.owner == RESERVED);
+        start = std::min(start, iter->first);
+        end = std::max(end, iter->second.end);
+        iter = intervals.erase(iter);
+    }
+
+    intervals.insert({start, Interval{.end = end, .owner = RESERVED}});
+}
+
+void LiveIntervalUnion::remove(unsigned start) {
+    intervals.erase(start);
+}
+
+std::map<unsigned, LiveIntervalUnion::Interval>::const_iterator LiveIntervalUnion::find_last_starting_before(
+    unsigned point
+) const {
+    auto iter = intervals.upper_bound(point);
+
+    if (iter == intervals.begin()) {
+        return intervals.end();
+    } else {
+        return std::prev(iter);
+    }
+}
+
+} // namespace codegen
+
+} // namespace banjo
@@ -0,0 +1,45 @@
+#ifndef BANJO_CODEGEN_LIVE_INTERVAL_UNION_H
+#define BANJO_CODEGEN_LIVE_INTERVAL_UNION_H
+
+#include <map>
+#include <optional>
+
+namespace banjo {
+
+namespace codegen {
+
+// The set of intervals during which a physical register is occupied. Intervals are closed ranges of
+// function-wide program points and never overlap, so they can be kept sorted by their start point
+// and every query only has to look at a single neighbor, making queries logarithmic in the number
+// of intervals.
+class LiveIntervalUnion {
+
+public:
+    // Owner of intervals that are reserved for fixed physical registers.
+    static constexpr unsigned RESERVED = ~0u;
+
+private:
+    struct Interval {
+        unsigned end;
+        unsigned owner;
+    };
+
+    std::map<unsigned, Interval> intervals;
+
+public:
+    bool overlaps(unsigned start, unsigned end) const;
+    std::optional<unsigned> find_containing(unsigned start, unsigned end) const;
+
+    void insert(unsigned start, unsigned end, unsigned owner);
+    void insert_reserved(unsigned start, unsigned end);
+    void remove(unsigned start);
+
+private:
+    std::map<unsigned, Interval>::const_iterator find_last_starting_before(unsigned point) const;
+};
+
+} // namespace codegen
+
+} // namespace banjo
+
+#endif
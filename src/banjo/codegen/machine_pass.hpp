@@ -9,7 +9,14 @@ class MachinePass {
 
 public:
     virtual ~MachinePass() = default;
-    virtual void run(mcode::Module &mod) = 0;
+
+    virtual void run(mcode::Module &mod) {
+        for (mcode::Function *func : mod.get_functions()) {
+            run(*func);
+        }
+    }
+
+    virtual void run(mcode::Function &func) = 0;
 };
 
 } // namespace banjo::codegen
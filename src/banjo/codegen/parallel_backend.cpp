@@ -0,0 +1,110 @@
+#include "parallel_backend.hpp"
+
+#include "banjo/codegen/machine_pass.hpp"
+#include "banjo/codegen/ssa_lowerer.hpp"
+#include "banjo/utils/timing.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace banjo::codegen {
+
+ParallelBackend::ParallelBackend(
+    target::Target *target,
+    utils::TaskScheduler &task_scheduler,
+    BuildCache *build_cache /* = nullptr */
+)
+  : target{target},
+    task_scheduler{task_scheduler},
+    build_cache{build_cache} {}
+
+mcode::Module ParallelBackend::generate(ssa::Module &mod) {
+    PROFILE_SCOPE("parallel backend");
+
+    std::vector<ssa::Function *> &funcs = mod.get_functions();
+    std::vector<mcode::Module> fragments(funcs.size());
+
+    std::unique_ptr<SSALowerer> lowerer{target->create_ssa_lowerer()};
+    lowerer->begin_module(mod);
+
+    if (build_cache) {
+        build_cache->begin_module(mod);
+    }
+
+    task_scheduler.parallel_for(0, funcs.size(), [this, &mod, &funcs, &fragments, &lowerer](std::size_t i) {
+        fragments[i] = generate_func(mod, *funcs[i], *lowerer);
+    });
+
+    mcode::Module &machine_module = lowerer->get_machine_module();
+    std::unordered_set<std::string> global_names;
+
+    for (mcode::Global &global : machine_module.get_globals()) {
+        global_names.insert(global.name);
+    }
+
+    for (mcode::Module &fragment : fragments) {
+        merge(machine_module, fragment, global_names);
+    }
+
+    return lowerer->end_module();
+}
+
+mcode::Module ParallelBackend::generate_func(ssa::Module &mod, ssa::Function &func, SSALowerer &module_lowerer) {
+    if (!build_cache) {
+        return lower_func(mod, func);
+    }
+
+    std::uint64_t key = build_cache->compute_key(func);
+    mcode::CallingConvention *calling_conv = module_lowerer.get_calling_convention(func.type.calling_conv);
+
+    if (std::optional<mcode::Module> fragment = build_cache->load(key, calling_conv)) {
+        return std::move(*fragment);
+    }
+
+    mcode::Module fragment = lower_func(mod, func);
+    build_cache->store(key, fragment);
+    return fragment;
+}
+
+mcode::Module ParallelBackend::lower_func(ssa::Module &mod, ssa::Function &func) {
+    std::unique_ptr<SSALowerer> lowerer{target->create_ssa_lowerer()};
+    lowerer->begin_module(mod);
+    lowerer->lower_func(func);
+
+    mcode::Module fragment = std::move(lowerer->get_machine_module());
+    mcode::Function &machine_func = *fragment.get_functions().front();
+
+    for (std::unique_ptr<MachinePass> &pass : target->create_passes()) {
+        pass->run(machine_func);
+    }
+
+    return fragment;
+}
+
+void ParallelBackend::merge(
+    mcode::Module &dst,
+    mcode::Module &fragment,
+    std::unordered_set<std::string> &global_names
+) {
+    for (mcode::Function *func : fragment.get_functions()) {
+        dst.add(func);
+    }
+
+    // The functions are owned by the destination module now.
+    fragment.get_functions().clear();
+
+    // Every fragment contains the globals created during module initialization and constants
+    // that might be shared with other functions, so globals are deduplicated by name.
+    for (mcode::Global &global : fragment.get_globals()) {
+        if (global_names.insert(global.name).second) {
+            dst.add(std::move(global));
+        }
+    }
+
+    for (const std::string &global_symbol : fragment.get_global_symbols()) {
+        dst.add_global_symbol(global_symbol);
+    }
+}
+
+} // namespace banjo::codegen
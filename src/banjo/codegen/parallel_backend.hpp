@@ -0,0 +1,39 @@
+#ifndef BANJO_CODEGEN_PARALLEL_BACKEND_H
+#define BANJO_CODEGEN_PARALLEL_BACKEND_H
+
+#include "banjo/codegen/build_cache.hpp"
+#include "banjo/codegen/ssa_lowerer.hpp"
+#include "banjo/mcode/module.hpp"
+#include "banjo/ssa/module.hpp"
+#include "banjo/target/target.hpp"
+#include "banjo/utils/task_scheduler.hpp"
+
+#include <string>
+#include <unordered_set>
+
+namespace banjo::codegen {
+
+// Lowers functions and runs the machine passes over them on the threads of a task scheduler. Every
+// function is lowered by its own lowerer into a separate fragment module. The fragments are merged
+// in the order of the SSA functions, so the result is the same as the one of the sequential backend.
+// If a build cache is passed, fragments of unchanged functions are loaded from the cache instead.
+class ParallelBackend {
+
+private:
+    target::Target *target;
+    utils::TaskScheduler &task_scheduler;
+    BuildCache *build_cache;
+
+public:
+    ParallelBackend(target::Target *target, utils::TaskScheduler &task_scheduler, BuildCache *build_cache = nullptr);
+    mcode::Module generate(ssa::Module &mod);
+
+private:
+    mcode::Module generate_func(ssa::Module &mod, ssa::Function &func, SSALowerer &module_lowerer);
+    mcode::Module lower_func(ssa::Module &mod, ssa::Function &func);
+    void merge(mcode::Module &dst, mcode::Module &fragment, std::unordered_set<std::string> &global_names);
+};
+
+} // namespace banjo::codegen
+
+#endif
@@ -5,12 +5,6 @@
 
 namespace banjo::codegen {
 
-void PrologEpilogPass::run(mcode::Module &mod) {
-    for (mcode::Function *func : mod.get_functions()) {
-        run(*func);
-    }
-}
-
 void PrologEpilogPass::run(mcode::Function &func) {
     PROFILE_SCOPE("prolog/epilog insertion");
 
@@ -8,8 +8,7 @@ namespace banjo::codegen {
 class PrologEpilogPass : public MachinePass {
 
 public:
-    void run(mcode::Module &mod) override;
-    void run(mcode::Function &func);
+    void run(mcode::Function &func) override;
 
 private:
     void insert_prolog(mcode::Function &func);
@@ -47,17 +47,12 @@ struct LiveRange {
     }
 };
 
-struct ReservedSegment {
-    mcode::PhysicalReg reg;
-    LiveRange range;
-};
-
 struct RegAllocBlock {
     mcode::BasicBlockIter m_block;
     std::vector<RegAllocInstr> instrs;
     std::vector<unsigned> preds;
     std::vector<unsigned> succs;
-    std::vector<ReservedSegment> reserved_segments;
+    unsigned loop_depth;
 };
 
 struct RegAllocFunc {
@@ -71,6 +66,7 @@ typedef std::unordered_map<mcode::VirtualReg, RegClass> RegClassMap;
 struct Segment {
     mcode::VirtualReg reg;
     LiveRange range;
+    bool reload = false; // load the value from the home stack slot before the segment starts
 };
 
 struct Bundle {
@@ -79,6 +75,9 @@ struct Bundle {
     bool evictable = true;
     std::optional<mcode::StackSlotID> src_stack_slot = {};
     std::optional<mcode::StackSlotID> dst_stack_slot = {};
+    std::optional<mcode::StackSlotID> home_stack_slot = {}; // set for bundles produced by splitting
+    bool call_sites_split = false;
+    unsigned loop_weight = 0;
     bool deleted = false;
 };
 
@@ -10,26 +10,38 @@
 #include "banjo/target/aarch64/aarch64_address.hpp"
 #include "banjo/utils/timing.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <optional>
 #include <queue>
+#include <set>
+#include <unordered_map>
 #include <vector>
 
 namespace banjo {
 
 namespace codegen {
 
+// Uses and defs in loops are weighted with `16 * 8^depth` up to a depth of 3.
+static constexpr unsigned LOOP_USE_WEIGHT = 16;
+static constexpr unsigned LOOP_WEIGHT_SHIFT = 3;
+static constexpr unsigned MAX_WEIGHTED_LOOP_DEPTH = 3;
+
+static std::uint64_t get_instr_key(unsigned block, unsigned instr) {
+    return (static_cast<std::uint64_t>(block) << 32) | instr;
+}
+
 RegAllocPass::RegAllocPass(target::TargetRegAnalyzer &analyzer) : analyzer(analyzer) {}
 
 void RegAllocPass::run(mcode::Module &mod) {
     PROFILE_SCOPE("register allocation");
 
     // Things to be done:
-    // - Bundle splitting
     // - Evicting bundles with a lower weight for bundles that were not produced by spilling
     // - If two live ranges intersect, the same physical register should be assigned
     //   if the register is only read from during the intersection of the two ranges
-    // - Improving weight calculation (e.g. assign a higher score for bundles in loops)
-    // - Smarter load/store placement for spilled bundles
+    // - Sinking the stores of split bundles out of loops
 
     for (mcode::Function *func : mod.get_functions()) {
         run(*func);
@@ -43,11 +55,18 @@ void RegAllocPass::run(mcode::Function &func) {
     Context ctx{.func = ra_func, .liveness = liveness};
 
     assign_reg_classes(ctx);
+    compute_block_offsets(ctx);
+    compute_block_regions(ctx);
+    collect_call_sites(ctx);
     reserve_fixed_ranges(ctx);
 
     std::vector<Bundle> bundles = create_bundles(ctx);
     bundles = coalesce_bundles(ctx, bundles);
 
+    for (Bundle &bundle : bundles) {
+        compute_loop_weight(ctx, bundle);
+    }
+
     BundleComparator comparator;
     ctx.bundles = Queue{comparator, bundles};
 
@@ -95,6 +114,7 @@ RegAllocFunc RegAllocPass::create_reg_alloc_func(mcode::Function &func) {
                 .instrs = collect_instrs(*iter),
                 .preds = ra_preds,
                 .succs = ra_succs,
+                .loop_depth = iter->get_loop_depth(),
             }
         );
     }
@@ -123,6 +143,13 @@ void RegAllocPass::assign_reg_classes(Context &ctx) {
     for (mcode::BasicBlock &block : ctx.func.m_func) {
         for (mcode::Instruction &instr : block) {
             analyzer.assign_reg_classes(instr, ctx.reg_classes);
+
+            // Registers holding vectors need larger spill slots than the default 8 bytes.
+            for (mcode::Operand &operand : instr.get_operands()) {
+                if (operand.is_virtual_reg() && operand.get_size() > 8) {
+                    ctx.wide_regs.insert(operand.get_virtual_reg());
+                }
+            }
         }
     }
 }
@@ -135,10 +162,7 @@ void RegAllocPass::reserve_fixed_ranges(Context &ctx) {
         }
 
         for (LiveRange &range : ranges) {
-            ctx.func.blocks[range.block].reserved_segments.push_back({
-                .reg = static_cast<mcode::PhysicalReg>(reg.get_physical_reg()),
-                .range = range,
-            });
+            reserve_range(ctx, static_cast<mcode::PhysicalReg>(reg.get_physical_reg()), range);
         }
     }
 
@@ -148,17 +172,80 @@ void RegAllocPass::reserve_fixed_ranges(Context &ctx) {
 
         RegAllocPoint ra_point{.instr = kill_point.instr, .stage = 1};
 
-        ctx.func.blocks[kill_point.block].reserved_segments.push_back({
-            .reg = kill_point.reg,
-            .range{
-                .block = kill_point.block,
-                .start = ra_point,
-                .end = ra_point,
-            },
-        });
+        LiveRange range{
+            .block = kill_point.block,
+            .start = ra_point,
+            .end = ra_point,
+        };
+
+        reserve_range(ctx, kill_point.reg, range);
     }
 }
 
+void RegAllocPass::compute_block_offsets(Context &ctx) {
+    // Program points are numbered across the whole function so that the ranges of all blocks can be
+    // stored in a single interval union per physical register.
+
+    unsigned offset = 0;
+
+    for (RegAllocBlock &block : ctx.func.blocks) {
+        ctx.block_offsets.push_back(offset);
+        offset += 2 * (block.instrs.size() + 1);
+    }
+}
+
+void RegAllocPass::compute_block_regions(Context &ctx) {
+    // Bundles are split into regions that are allocated independently. Connected blocks with the
+    // same loop depth form a region, and all blocks outside of loops share a single region.
+
+    unsigned num_blocks = ctx.func.blocks.size();
+    ctx.block_regions.assign(num_blocks, num_blocks);
+
+    for (unsigned i = 0; i < num_blocks; i++) {
+        if (ctx.func.blocks[i].loop_depth == 0 || ctx.block_regions[i] != num_blocks) {
+            continue;
+        }
+
+        std::vector<unsigned> worklist{i};
+        ctx.block_regions[i] = i;
+
+        while (!worklist.empty()) {
+            RegAllocBlock &block = ctx.func.blocks[worklist.back()];
+            worklist.pop_back();
+
+            for (const std::vector<unsigned> *neighbors : {&block.preds, &block.succs}) {
+                for (unsigned neighbor : *neighbors) {
+                    bool same_loop_depth = ctx.func.blocks[neighbor].loop_depth == block.loop_depth;
+
+                    if (same_loop_depth && ctx.block_regions[neighbor] == num_blocks) {
+                        ctx.block_regions[neighbor] = i;
+                        worklist.push_back(neighbor);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void RegAllocPass::collect_call_sites(Context &ctx) {
+    // Calls are the instructions that kill registers.
+
+    ctx.block_call_sites.resize(ctx.func.blocks.size());
+
+    for (KillPoint &kill_point : ctx.liveness.kill_points) {
+        ctx.block_call_sites[kill_point.block].push_back(kill_point.instr);
+    }
+
+    for (std::vector<unsigned> &call_sites : ctx.block_call_sites) {
+        std::sort(call_sites.begin(), call_sites.end());
+        call_sites.erase(std::unique(call_sites.begin(), call_sites.end()), call_sites.end());
+    }
+}
+
+void RegAllocPass::reserve_range(Context &ctx, mcode::PhysicalReg reg, const LiveRange &range) {
+    get_reg_intervals(ctx, reg).insert_reserved(get_start_point(ctx, range), get_end_point(ctx, range));
+}
+
 std::vector<Bundle> RegAllocPass::create_bundles(Context &ctx) {
     std::vector<Bundle> bundles;
 
@@ -187,20 +274,60 @@ std::vector<Bundle> RegAllocPass::create_bundles(Context &ctx) {
 }
 
 std::vector<Bundle> RegAllocPass::coalesce_bundles(Context &ctx, std::vector<Bundle> bundles) {
-    std::vector<Bundle> new_bundles;
+    // Only bundles with a single segment that is connected to another bundle by a move can be
+    // coalesced, so instead of trying every pair of bundles, these bundles are indexed by the
+    // instructions where their segments start with a def or end with a use.
+
+    std::unordered_map<std::uint64_t, std::vector<unsigned>> defs_at;
+    std::unordered_map<std::uint64_t, std::vector<unsigned>> last_uses_at;
+
+    for (unsigned i = 0; i < bundles.size(); i++) {
+        if (bundles[i].segments.size() != 1) {
+            continue;
+        }
+
+        const LiveRange &range = bundles[i].segments[0].range;
+
+        if (range.start.stage == 1) {
+            defs_at[get_instr_key(range.block, range.start.instr)].push_back(i);
+        }
+
+        if (range.end.stage == 0) {
+            last_uses_at[get_instr_key(range.block, range.end.instr)].push_back(i);
+        }
+    }
+
+    std::set<unsigned> candidates;
+
+    for (unsigned i = 0; i < bundles.size(); i++) {
+        Bundle &bundle = bundles[i];
 
-    for (Bundle &bundle : bundles) {
         if (bundle.deleted) {
             continue;
         }
 
-        for (Bundle &other : bundles) {
-            if (!other.deleted) {
-                try_coalesce(ctx, bundle, other);
+        for (const Segment &segment : bundle.segments) {
+            collect_coalesce_candidates(segment, 0, defs_at, last_uses_at, candidates);
+        }
+
+        // Candidates are visited in the order of the bundles. Segments added by coalescing can
+        // only enable candidates that come after the bundle that was just coalesced.
+        while (!candidates.empty()) {
+            unsigned candidate = *candidates.begin();
+            candidates.erase(candidates.begin());
+
+            if (candidate == i || bundles[candidate].deleted) {
+                continue;
+            }
+
+            if (try_coalesce(ctx, bundle, bundles[candidate])) {
+                collect_coalesce_candidates(bundle.segments.back(), candidate + 1, defs_at, last_uses_at, candidates);
             }
         }
     }
 
+    std::vector<Bundle> new_bundles;
+
     for (Bundle &bundle : bundles) {
         if (!bundle.deleted) {
             new_bundles.push_back(bundle);
@@ -210,9 +337,45 @@ std::vector<Bundle> RegAllocPass::coalesce_bundles(Context &ctx, std::vector<Bun
     return new_bundles;
 }
 
-void RegAllocPass::try_coalesce(Context &ctx, Bundle &a, Bundle &b) {
+void RegAllocPass::collect_coalesce_candidates(
+    const Segment &segment,
+    unsigned min_index,
+    std::unordered_map<std::uint64_t, std::vector<unsigned>> &defs_at,
+    std::unordered_map<std::uint64_t, std::vector<unsigned>> &last_uses_at,
+    std::set<unsigned> &candidates
+) {
+    const LiveRange &range = segment.range;
+
+    // Bundles whose last use is a move defining this segment.
+    if (range.start.stage == 1) {
+        auto iter = last_uses_at.find(get_instr_key(range.block, range.start.instr));
+
+        if (iter != last_uses_at.end()) {
+            for (unsigned index : iter->second) {
+                if (index >= min_index) {
+                    candidates.insert(index);
+                }
+            }
+        }
+    }
+
+    // Bundles defined by a move that is the last use of this segment.
+    if (range.end.stage == 0) {
+        auto iter = defs_at.find(get_instr_key(range.block, range.end.instr));
+
+        if (iter != defs_at.end()) {
+            for (unsigned index : iter->second) {
+                if (index >= min_index) {
+                    candidates.insert(index);
+                }
+            }
+        }
+    }
+}
+
+bool RegAllocPass::try_coalesce(Context &ctx, Bundle &a, Bundle &b) {
     if (a.reg_class != b.reg_class || b.segments.size() != 1) {
-        return;
+        return false;
     }
 
     const Segment &segment_b = b.segments[0];
@@ -234,7 +397,32 @@ void RegAllocPass::try_coalesce(Context &ctx, Bundle &a, Bundle &b) {
         if (is_connecting && !intersect(a, b)) {
             a.segments.push_back(segment_b);
             b.deleted = true;
-            return;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void RegAllocPass::compute_loop_weight(Context &ctx, Bundle &bundle) {
+    bundle.loop_weight = 0;
+
+    for (const Segment &segment : bundle.segments) {
+        RegAllocBlock &block = ctx.func.blocks[segment.range.block];
+
+        if (block.loop_depth == 0) {
+            continue;
+        }
+
+        unsigned loop_depth = std::min(block.loop_depth, MAX_WEIGHTED_LOOP_DEPTH);
+        unsigned use_weight = LOOP_USE_WEIGHT << (LOOP_WEIGHT_SHIFT * loop_depth);
+
+        for (unsigned index = segment.range.start.instr; index <= segment.range.end.instr; index++) {
+            for (mcode::RegOp op : block.instrs[index].regs) {
+                if (op.reg == mcode::Register::from_virtual(segment.reg)) {
+                    bundle.loop_weight += use_weight;
+                }
+            }
         }
     }
 }
@@ -279,6 +467,11 @@ void RegAllocPass::alloc_bundle(Context &ctx, Bundle &bundle) {
         return;
     }
 
+    // Next, try to split the bundle so that at least some parts of it end up in a register.
+    if (try_split(ctx, bundle)) {
+        return;
+    }
+
     // Finally, we're defeated and spill to the stack.
     spill(ctx, bundle);
 }
@@ -313,24 +506,17 @@ bool RegAllocPass::try_alloc_physical_reg(Context &ctx, Bundle &bundle, mcode::P
 
     Alloc alloc{.physical_reg = reg, .bundle = bundle};
     ctx.allocs.push_back(alloc);
+    insert_alloc_intervals(ctx, ctx.allocs.size() - 1);
 
     return true;
 }
 
 bool RegAllocPass::is_alloc_possible(Context &ctx, Bundle &bundle, mcode::PhysicalReg reg) {
-    for (Segment &segment : bundle.segments) {
-        for (ReservedSegment &reserved_segment : ctx.func.blocks[segment.range.block].reserved_segments) {
-            if (reg == reserved_segment.reg && segment.range.intersects(reserved_segment.range)) {
-                return false;
-            }
-        }
+    LiveIntervalUnion &intervals = get_reg_intervals(ctx, reg);
 
-        for (const Alloc &alloc : ctx.allocs) {
-            for (const Segment &alloc_range : alloc.bundle.segments) {
-                if (alloc.physical_reg == reg && alloc_range.range.intersects(segment.range)) {
-                    return false;
-                }
-            }
+    for (Segment &segment : bundle.segments) {
+        if (intervals.overlaps(get_start_point(ctx, segment.range), get_end_point(ctx, segment.range))) {
+            return false;
         }
     }
 
@@ -338,43 +524,236 @@ bool RegAllocPass::is_alloc_possible(Context &ctx, Bundle &bundle, mcode::Physic
 }
 
 bool RegAllocPass::try_evict(Context &ctx, Bundle &bundle) {
-    if (bundle.evictable) {
+    if (bundle.evictable || bundle.segments.empty()) {
         return false;
     }
 
-    for (auto iter = ctx.allocs.begin(); iter != ctx.allocs.end(); ++iter) {
-        Alloc &alloc = *iter;
+    // An evictable allocation has to contain the first segment of the bundle, so only the
+    // allocations containing it are considered. They are tried in the order they were created in.
+
+    const LiveRange &first_range = bundle.segments[0].range;
+    unsigned start = get_start_point(ctx, first_range);
+    unsigned end = get_end_point(ctx, first_range);
+
+    std::set<unsigned> alloc_indices;
 
-        if (!can_evict(bundle, alloc)) {
+    for (LiveIntervalUnion &intervals : ctx.reg_intervals) {
+        std::optional<unsigned> owner = intervals.find_containing(start, end);
+
+        if (owner && *owner != LiveIntervalUnion::RESERVED) {
+            alloc_indices.insert(*owner);
+        }
+    }
+
+    for (unsigned alloc_index : alloc_indices) {
+        if (!can_evict(ctx, bundle, alloc_index)) {
             continue;
         }
 
+        Alloc &alloc = ctx.allocs[alloc_index];
+        remove_alloc_intervals(ctx, alloc_index);
         ctx.bundles.push(alloc.bundle);
         alloc.bundle = bundle;
+        insert_alloc_intervals(ctx, alloc_index);
         return true;
     }
 
     return false;
 }
 
-bool RegAllocPass::can_evict(Bundle &bundle, Alloc &alloc) {
+bool RegAllocPass::can_evict(Context &ctx, Bundle &bundle, unsigned alloc_index) {
+    Alloc &alloc = ctx.allocs[alloc_index];
+
     if (!alloc.bundle.evictable || alloc.bundle.reg_class != bundle.reg_class) {
         return false;
     }
 
     // For each segment, check that it is inside a segment of the existing allocation to make sure
     // that the register is actually available in all segments of the bundle.
+    LiveIntervalUnion &intervals = get_reg_intervals(ctx, alloc.physical_reg);
+
     for (Segment &segment : bundle.segments) {
-        bool found_containing_segment = false;
+        unsigned start = get_start_point(ctx, segment.range);
+        unsigned end = get_end_point(ctx, segment.range);
+
+        if (intervals.find_containing(start, end) != alloc_index) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool RegAllocPass::try_split(Context &ctx, Bundle &bundle) {
+    // Bundles produced by spilling only cover a single instruction and can't be split any further.
+    if (!bundle.evictable) {
+        return false;
+    }
+
+    // All parts of a split bundle share a stack slot that always holds the current value. Every
+    // def stores the value to the slot and parts that don't receive the value in their register
+    // reload it from there.
+    if (!bundle.home_stack_slot) {
+        bundle.home_stack_slot = create_spill_slot(ctx, bundle);
+
+        if (split_around_loops(ctx, bundle)) {
+            return true;
+        }
+    }
+
+    return split_around_calls(ctx, bundle);
+}
+
+bool RegAllocPass::split_around_loops(Context &ctx, Bundle &bundle) {
+    std::vector<Bundle> parts;
+    std::unordered_map<unsigned, unsigned> region_parts;
+    std::vector<std::pair<unsigned, unsigned>> segment_indices;
+    std::unordered_map<std::uint64_t, unsigned> live_out_parts;
+
+    for (const Segment &segment : bundle.segments) {
+        unsigned region = ctx.block_regions[segment.range.block];
+        auto [iter, inserted] = region_parts.try_emplace(region, parts.size());
+
+        if (inserted) {
+            parts.push_back(Bundle{.reg_class = bundle.reg_class, .home_stack_slot = bundle.home_stack_slot});
+        }
+
+        unsigned part_index = iter->second;
+        segment_indices.push_back({part_index, parts[part_index].segments.size()});
+        parts[part_index].segments.push_back(segment);
+
+        if (is_live_out(ctx, segment)) {
+            live_out_parts.insert({get_instr_key(segment.range.block, segment.reg), part_index});
+        }
+    }
+
+    if (parts.size() == 1) {
+        return false;
+    }
+
+    // A part only has to reload the value when entering its region from a block where the value
+    // is not in the same register.
 
-        for (Segment &alloc_segment : alloc.bundle.segments) {
-            if (alloc_segment.range.contains(segment.range)) {
-                found_containing_segment = true;
+    for (unsigned i = 0; i < bundle.segments.size(); i++) {
+        const Segment &segment = bundle.segments[i];
+        auto [part_index, index_in_part] = segment_indices[i];
+
+        if (!is_live_in(ctx, segment)) {
+            continue;
+        }
+
+        std::vector<unsigned> entering_preds;
+
+        for (unsigned pred : ctx.func.blocks[segment.range.block].preds) {
+            auto iter = live_out_parts.find(get_instr_key(pred, segment.reg));
+
+            if (iter == live_out_parts.end() || iter->second != part_index) {
+                entering_preds.push_back(pred);
+            }
+        }
+
+        if (entering_preds.empty()) {
+            continue;
+        }
+
+        // Reloading at the end of the predecessors keeps the loads out of loop headers, which
+        // would otherwise execute them on every iteration.
+        bool reload_in_preds = std::all_of(entering_preds.begin(), entering_preds.end(), [&](unsigned pred) {
+            return can_reload_at_end(ctx, pred, segment.reg);
+        });
+
+        if (!reload_in_preds) {
+            parts[part_index].segments[index_in_part].reload = true;
+            continue;
+        }
+
+        for (unsigned pred : entering_preds) {
+            unsigned last_instr = ctx.func.blocks[pred].instrs.size() - 1;
+
+            parts[part_index].segments.push_back(
+                Segment{
+                    .reg = segment.reg,
+                    .range{.block = pred, .start{last_instr, 0}, .end{last_instr, 1}},
+                    .reload = true,
+                }
+            );
+        }
+    }
+
+    for (Bundle &part : parts) {
+        compute_loop_weight(ctx, part);
+        ctx.bundles.push(part);
+    }
+
+    stats.num_splits += 1;
+    return true;
+}
+
+bool RegAllocPass::split_around_calls(Context &ctx, Bundle &bundle) {
+    // Segments are cut at calls so that the parts between calls can use caller-saved registers.
+    // The part after a call reloads the value.
+
+    if (bundle.call_sites_split) {
+        return false;
+    }
+
+    std::vector<Segment> segments;
+
+    for (const Segment &segment : bundle.segments) {
+        RegAllocBlock &block = ctx.func.blocks[segment.range.block];
+        Segment remaining = segment;
+
+        for (unsigned call_site : ctx.block_call_sites[segment.range.block]) {
+            RegAllocPoint clobber{call_site, 1};
+            RegAllocPoint after_call{call_site + 1, 0};
+
+            if (clobber.value() <= remaining.range.start.value()) {
+                continue;
+            }
+
+            if (remaining.range.end.value() < after_call.value()) {
                 break;
             }
+
+            if (is_defined_at(block.instrs[call_site], segment.reg)) {
+                continue;
+            }
+
+            Segment before_call = remaining;
+            before_call.range.end = {call_site, 0};
+            segments.push_back(before_call);
+
+            remaining.range.start = after_call;
+            remaining.reload = true;
         }
 
-        if (!found_containing_segment) {
+        segments.push_back(remaining);
+    }
+
+    if (segments.size() == bundle.segments.size()) {
+        return false;
+    }
+
+    bundle.segments = segments;
+    bundle.call_sites_split = true;
+    ctx.bundles.push(bundle);
+
+    stats.num_splits += 1;
+    return true;
+}
+
+bool RegAllocPass::can_reload_at_end(Context &ctx, unsigned block_index, mcode::VirtualReg reg) {
+    // The value can only be reloaded at the end of the block if the block doesn't branch to other
+    // blocks where it isn't needed and the last instruction (usually the jump) doesn't touch it.
+
+    RegAllocBlock &block = ctx.func.blocks[block_index];
+
+    if (block.succs.size() != 1 || block.instrs.empty()) {
+        return false;
+    }
+
+    for (mcode::RegOp op : block.instrs.back().regs) {
+        if (op.reg == mcode::Register::from_virtual(reg)) {
             return false;
         }
     }
@@ -382,9 +761,37 @@ bool RegAllocPass::can_evict(Bundle &bundle, Alloc &alloc) {
     return true;
 }
 
+bool RegAllocPass::is_live_in(Context &ctx, const Segment &segment) {
+    const RegAllocPoint &start = segment.range.start;
+    const mcode::RegisterSet &ins = ctx.liveness.block_liveness[segment.range.block].ins;
+    return start.instr == 0 && start.stage == 0 && ins.contains(mcode::Register::from_virtual(segment.reg));
+}
+
+bool RegAllocPass::is_live_out(Context &ctx, const Segment &segment) {
+    const RegAllocPoint &end = segment.range.end;
+    unsigned last_instr = ctx.func.blocks[segment.range.block].instrs.size() - 1;
+    const mcode::RegisterSet &outs = ctx.liveness.block_liveness[segment.range.block].outs;
+    return end.instr == last_instr && end.stage == 1 && outs.contains(mcode::Register::from_virtual(segment.reg));
+}
+
+bool RegAllocPass::is_defined_at(const RegAllocInstr &instr, mcode::VirtualReg reg) {
+    for (mcode::RegOp op : instr.regs) {
+        if (op.reg == mcode::Register::from_virtual(reg) && op.usage != mcode::RegUsage::USE) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void RegAllocPass::spill(Context &ctx, Bundle &bundle) {
-    mcode::StackFrame &stack_frame = ctx.func.m_func.get_stack_frame();
-    mcode::StackSlotID stack_slot = stack_frame.new_stack_slot({mcode::StackSlot::Type::GENERIC, 8, 1});
+    mcode::StackSlotID stack_slot;
+
+    if (bundle.home_stack_slot) {
+        stack_slot = *bundle.home_stack_slot;
+    } else {
+        stack_slot = create_spill_slot(ctx, bundle);
+    }
 
     for (Segment &range : bundle.segments) {
         const RegAllocBlock &block = ctx.func.blocks[range.range.block];
@@ -440,24 +847,72 @@ void RegAllocPass::spill(Context &ctx, Bundle &bundle) {
     }
 }
 
-void RegAllocPass::apply_alloc(Context &ctx, const Alloc &alloc) {
-    if (alloc.bundle.src_stack_slot) {
-        const Segment &segment = alloc.bundle.segments[0];
-        RegAllocBlock &block = ctx.func.blocks[segment.range.block];
+mcode::StackSlotID RegAllocPass::create_spill_slot(Context &ctx, const Bundle &bundle) {
+    unsigned size = 8;
 
-        analyzer.insert_load({
-            .instr_iter = block.instrs[segment.range.start.instr].iter,
-            .block = *block.m_block,
-            .stack_slot = *alloc.bundle.src_stack_slot,
-            .reg = alloc.physical_reg,
-            .reg_class = alloc.bundle.reg_class,
-        });
+    for (const Segment &segment : bundle.segments) {
+        if (ctx.wide_regs.contains(segment.reg)) {
+            size = 16;
+            break;
+        }
     }
 
+    mcode::StackFrame &stack_frame = ctx.func.m_func.get_stack_frame();
+    return stack_frame.new_stack_slot({mcode::StackSlot::Type::GENERIC, size, 1});
+}
+
+void RegAllocPass::insert_alloc_intervals(Context &ctx, unsigned alloc_index) {
+    const Alloc &alloc = ctx.allocs[alloc_index];
+    LiveIntervalUnion &intervals = get_reg_intervals(ctx, alloc.physical_reg);
+
+    for (const Segment &segment : alloc.bundle.segments) {
+        intervals.insert(get_start_point(ctx, segment.range), get_end_point(ctx, segment.range), alloc_index);
+    }
+}
+
+void RegAllocPass::remove_alloc_intervals(Context &ctx, unsigned alloc_index) {
+    const Alloc &alloc = ctx.allocs[alloc_index];
+    LiveIntervalUnion &intervals = get_reg_intervals(ctx, alloc.physical_reg);
+
+    for (const Segment &segment : alloc.bundle.segments) {
+        intervals.remove(get_start_point(ctx, segment.range));
+    }
+}
+
+LiveIntervalUnion &RegAllocPass::get_reg_intervals(Context &ctx, mcode::PhysicalReg reg) {
+    if (reg >= ctx.reg_intervals.size()) {
+        ctx.reg_intervals.resize(reg + 1);
+    }
+
+    return ctx.reg_intervals[reg];
+}
+
+unsigned RegAllocPass::get_start_point(Context &ctx, const LiveRange &range) {
+    return ctx.block_offsets[range.block] + range.start.value();
+}
+
+unsigned RegAllocPass::get_end_point(Context &ctx, const LiveRange &range) {
+    return ctx.block_offsets[range.block] + range.end.value();
+}
+
+void RegAllocPass::apply_alloc(Context &ctx, const Alloc &alloc) {
     for (const Segment &segment : alloc.bundle.segments) {
         RegAllocBlock &block = ctx.func.blocks[segment.range.block];
         ctx.block_iter = block.m_block;
 
+        if (segment.reload) {
+            analyzer.insert_load({
+                .instr_iter = block.instrs[segment.range.start.instr].iter,
+                .block = *block.m_block,
+                .stack_slot = *alloc.bundle.home_stack_slot,
+                .reg = alloc.physical_reg,
+                .reg_class = alloc.bundle.reg_class,
+                .allow_folding = false,
+            });
+
+            count_spill_instr(block, stats.num_spill_loads);
+        }
+
         for (unsigned index = segment.range.start.instr; index <= segment.range.end.instr; index++) {
             mcode::InstrIter instr = block.instrs[index].iter;
 
@@ -465,6 +920,52 @@ void RegAllocPass::apply_alloc(Context &ctx, const Alloc &alloc) {
                 try_replace(operand, segment.reg, alloc.physical_reg);
             }
         }
+
+        if (!alloc.bundle.home_stack_slot) {
+            continue;
+        }
+
+        // Keep the home stack slot of split bundles up to date.
+        for (unsigned index = segment.range.start.instr; index <= segment.range.end.instr; index++) {
+            RegAllocPoint def_point{index, 1};
+
+            if (def_point.value() < segment.range.start.value() || def_point.value() > segment.range.end.value()) {
+                continue;
+            }
+
+            if (!is_defined_at(block.instrs[index], segment.reg)) {
+                continue;
+            }
+
+            analyzer.insert_store({
+                .instr_iter = block.instrs[index].iter,
+                .block = *block.m_block,
+                .stack_slot = *alloc.bundle.home_stack_slot,
+                .reg = alloc.physical_reg,
+                .reg_class = alloc.bundle.reg_class,
+                .allow_folding = false,
+            });
+
+            count_spill_instr(block, stats.num_spill_stores);
+        }
+    }
+
+    // Loads and stores are inserted after replacing the operands so that the target can tell which
+    // operand holds the spilled register when folding the stack slot into the instruction.
+
+    if (alloc.bundle.src_stack_slot) {
+        const Segment &segment = alloc.bundle.segments[0];
+        RegAllocBlock &block = ctx.func.blocks[segment.range.block];
+
+        analyzer.insert_load({
+            .instr_iter = block.instrs[segment.range.start.instr].iter,
+            .block = *block.m_block,
+            .stack_slot = *alloc.bundle.src_stack_slot,
+            .reg = alloc.physical_reg,
+            .reg_class = alloc.bundle.reg_class,
+        });
+
+        count_spill_instr(block, stats.num_spill_loads);
     }
 
     if (alloc.bundle.dst_stack_slot) {
@@ -478,6 +979,16 @@ void RegAllocPass::apply_alloc(Context &ctx, const Alloc &alloc) {
             .reg = alloc.physical_reg,
             .reg_class = alloc.bundle.reg_class,
         });
+
+        count_spill_instr(block, stats.num_spill_stores);
+    }
+}
+
+void RegAllocPass::count_spill_instr(const RegAllocBlock &block, unsigned &counter) {
+    counter += 1;
+
+    if (block.loop_depth > 0) {
+        stats.num_spills_in_loops += 1;
     }
 }
 
@@ -549,6 +1060,10 @@ unsigned RegAllocPass::BundleComparator::get_weight(const Bundle &bundle) {
     }
     score += longest_range;
 
+    // Bundles that are used inside of loops come next to the longest ones because spilling them
+    // puts memory accesses into every iteration.
+    score += bundle.loop_weight;
+
     return score;
 }
 
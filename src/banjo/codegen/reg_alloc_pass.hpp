@@ -1,6 +1,7 @@
 #ifndef BANJO_CODEGEN_REG_ALLOC_PASS_H
 #define BANJO_CODEGEN_REG_ALLOC_PASS_H
 
+#include "banjo/codegen/live_interval_union.hpp"
 #include "banjo/codegen/liveness.hpp"
 #include "banjo/codegen/machine_pass.hpp"
 #include "banjo/codegen/reg_alloc_func.hpp"
@@ -8,8 +9,12 @@
 #include "banjo/mcode/stack_frame.hpp"
 #include "banjo/target/target_reg_analyzer.hpp"
 
+#include <cstdint>
 #include <fstream>
 #include <queue>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #define DEBUG_REG_ALLOC 0
@@ -20,6 +25,14 @@ namespace codegen {
 
 class RegAllocPass : public MachinePass {
 
+public:
+    struct Stats {
+        unsigned num_spill_loads = 0;
+        unsigned num_spill_stores = 0;
+        unsigned num_spills_in_loops = 0;
+        unsigned num_splits = 0;
+    };
+
 private:
     struct BundleComparator {
         bool operator()(const Bundle &lhs, const Bundle &rhs);
@@ -40,10 +53,16 @@ private:
         RegClassMap reg_classes;
         Queue bundles;
         std::vector<Alloc> allocs;
+        std::vector<unsigned> block_offsets;
+        std::vector<LiveIntervalUnion> reg_intervals;
+        std::vector<unsigned> block_regions;
+        std::vector<std::vector<unsigned>> block_call_sites;
+        std::unordered_set<mcode::VirtualReg> wide_regs;
     };
 
     target::TargetRegAnalyzer &analyzer;
     std::vector<mcode::PhysicalReg> suggested_regs;
+    Stats stats;
 
 #if DEBUG_REG_ALLOC
     std::ofstream stream{"liveness.txt"};
@@ -51,18 +70,31 @@ private:
 
 public:
     RegAllocPass(target::TargetRegAnalyzer &analyzer);
-    void run(mcode::Module &mod);
-    void run(mcode::Function &func);
+    void run(mcode::Module &mod) override;
+    void run(mcode::Function &func) override;
+    const Stats &get_stats() { return stats; }
 
 private:
     RegAllocFunc create_reg_alloc_func(mcode::Function &func);
     std::vector<RegAllocInstr> collect_instrs(mcode::BasicBlock &basic_block);
     void assign_reg_classes(Context &ctx);
     void reserve_fixed_ranges(Context &ctx);
+    void compute_block_offsets(Context &ctx);
+    void compute_block_regions(Context &ctx);
+    void collect_call_sites(Context &ctx);
+    void reserve_range(Context &ctx, mcode::PhysicalReg reg, const LiveRange &range);
 
     std::vector<Bundle> create_bundles(Context &ctx);
     std::vector<Bundle> coalesce_bundles(Context &ctx, std::vector<Bundle> bundles);
-    void try_coalesce(Context &ctx, Bundle &a, Bundle &b);
+    void collect_coalesce_candidates(
+        const Segment &segment,
+        unsigned min_index,
+        std::unordered_map<std::uint64_t, std::vector<unsigned>> &defs_at,
+        std::unordered_map<std::uint64_t, std::vector<unsigned>> &last_uses_at,
+        std::set<unsigned> &candidates
+    );
+    bool try_coalesce(Context &ctx, Bundle &a, Bundle &b);
+    void compute_loop_weight(Context &ctx, Bundle &bundle);
     bool is_connecting_move(RegAllocBlock &block, const Segment &dst, const Segment &src);
     bool intersect(const Bundle &a, const Bundle &b);
 
@@ -72,10 +104,25 @@ private:
     bool try_alloc_physical_reg(Context &ctx, Bundle &bundle, mcode::PhysicalReg reg);
     bool is_alloc_possible(Context &ctx, Bundle &bundle, mcode::PhysicalReg reg);
     bool try_evict(Context &ctx, Bundle &bundle);
-    bool can_evict(Bundle &bundle, Alloc &alloc);
+    bool can_evict(Context &ctx, Bundle &bundle, unsigned alloc_index);
+    bool try_split(Context &ctx, Bundle &bundle);
+    bool split_around_loops(Context &ctx, Bundle &bundle);
+    bool split_around_calls(Context &ctx, Bundle &bundle);
+    bool can_reload_at_end(Context &ctx, unsigned block_index, mcode::VirtualReg reg);
+    bool is_live_in(Context &ctx, const Segment &segment);
+    bool is_live_out(Context &ctx, const Segment &segment);
+    bool is_defined_at(const RegAllocInstr &instr, mcode::VirtualReg reg);
     void spill(Context &ctx, Bundle &bundle);
+    mcode::StackSlotID create_spill_slot(Context &ctx, const Bundle &bundle);
+
+    void insert_alloc_intervals(Context &ctx, unsigned alloc_index);
+    void remove_alloc_intervals(Context &ctx, unsigned alloc_index);
+    LiveIntervalUnion &get_reg_intervals(Context &ctx, mcode::PhysicalReg reg);
+    unsigned get_start_point(Context &ctx, const LiveRange &range);
+    unsigned get_end_point(Context &ctx, const LiveRange &range);
 
     void apply_alloc(Context &ctx, const Alloc &alloc);
+    void count_spill_instr(const RegAllocBlock &block, unsigned &counter);
     void try_replace(mcode::Operand &operand, mcode::VirtualReg virtual_reg, mcode::PhysicalReg physical_reg);
     void remove_useless_instrs(mcode::BasicBlock &basic_block);
 
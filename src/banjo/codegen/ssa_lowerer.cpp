@@ -1,6 +1,7 @@
 #include "ssa_lowerer.hpp"
 
 #include "banjo/mcode/instruction.hpp"
+#include "banjo/passes/loop_analysis.hpp"
 #include "banjo/ssa/control_flow_graph.hpp"
 #include "banjo/ssa/virtual_register.hpp"
 #include "banjo/target/target_description.hpp"
@@ -8,6 +9,8 @@
 #include "banjo/utils/timing.hpp"
 
 #include <iostream>
+#include <unordered_map>
+#include <unordered_set>
 
 #define WARN_UNIMPLEMENTED(instruction) std::cerr << "warning: cannot lower instruction " << (instruction) << '\n';
 
@@ -20,6 +23,16 @@ SSALowerer::SSALowerer(target::Target *target) : target(target) {}
 mcode::Module SSALowerer::lower_module(ssa::Module &module_) {
     PROFILE_SCOPE("ssa lowering");
 
+    begin_module(module_);
+
+    for (ssa::Function *func : module_.get_functions()) {
+        lower_func(*func);
+    }
+
+    return end_module();
+}
+
+void SSALowerer::begin_module(ssa::Module &module_) {
     this->module_ = &module_;
     init_module(module_);
 
@@ -41,11 +54,9 @@ mcode::Module SSALowerer::lower_module(ssa::Module &module_) {
 
     lower_external_funcs();
     lower_external_globals();
+}
 
-    for (ssa::Function *func : module_.get_functions()) {
-        lower_func(*func);
-    }
-
+mcode::Module SSALowerer::end_module() {
     lower_globals();
     lower_dll_exports();
 
@@ -192,6 +203,22 @@ void SSALowerer::store_graphs() {
             m_iter->get_domtree_children().push_back(block_map.at(domtree_child_iter));
         }
     }
+
+    // The loop depth is used by the register allocator to avoid spilling inside of loops. Loops
+    // with multiple back edges are reported once per back edge, so their bodies are merged first.
+
+    std::unordered_map<unsigned, std::unordered_set<unsigned>> loop_bodies;
+
+    for (ssa::LoopAnalysis &loop : ssa::LoopAnalyzer(cfg, domtree).analyze()) {
+        loop_bodies[loop.header].insert(loop.body.begin(), loop.body.end());
+    }
+
+    for (auto &[header, body] : loop_bodies) {
+        for (unsigned node : body) {
+            mcode::BasicBlockIter m_iter = block_map.at(cfg.get_node(node).block);
+            m_iter->set_loop_depth(m_iter->get_loop_depth() + 1);
+        }
+    }
 }
 
 void SSALowerer::lower_instr(ssa::Instruction &instr) {
@@ -235,6 +262,7 @@ void SSALowerer::lower_instr(ssa::Instruction &instr) {
         case ssa::Opcode::MEMBERPTR: lower_memberptr(instr); break;
         case ssa::Opcode::COPY: lower_copy(instr); break;
         case ssa::Opcode::SQRT: lower_sqrt(instr); break;
+        case ssa::Opcode::SPLAT: lower_splat(instr); break;
         default: break;
     }
 }
@@ -540,6 +568,10 @@ void SSALowerer::lower_sqrt(ssa::Instruction &instr) {
     lower_call(call_instr);
 }
 
+void SSALowerer::lower_splat(ssa::Instruction &) {
+    WARN_UNIMPLEMENTED("splat");
+}
+
 ssa::InstrIter SSALowerer::get_producer(ssa::VirtualRegister reg) {
     ssa::BasicBlock &cur_block = get_block();
 
@@ -590,7 +622,7 @@ SSALowerer::AddrComponents SSALowerer::collect_addr(ssa::Operand &addr) {
 
     while (base->is_register()) {
         ssa::InstrIter producer = get_producer_globally(base->get_register());
-        if (!producer) {
+        if (producer == get_block().end()) {
             break;
         }
 
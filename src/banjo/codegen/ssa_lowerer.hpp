@@ -80,6 +80,10 @@ public:
 
     mcode::Module lower_module(ssa::Module &module_);
 
+    void begin_module(ssa::Module &module_);
+    void lower_func(ssa::Function &func);
+    mcode::Module end_module();
+
     const target::Target *get_target() const { return target; }
 
     ssa::Module &get_module() { return *module_; }
@@ -113,7 +117,6 @@ public:
     virtual mcode::CallingConvention *get_calling_convention(ssa::CallingConv calling_conv) = 0;
 
 protected:
-    void lower_func(ssa::Function &func);
     mcode::Parameter lower_param(ssa::Type type, mcode::ArgStorage storage, mcode::Function &m_func);
     void create_basic_block(ssa::BasicBlockIter ssa_block);
     void generate_basic_block(ssa::BasicBlockIter ssa_block, mcode::BasicBlock &m_block);
@@ -171,6 +174,7 @@ protected:
     virtual void lower_memberptr(ssa::Instruction &instr);
     virtual void lower_copy(ssa::Instruction &instr);
     virtual void lower_sqrt(ssa::Instruction &instr);
+    virtual void lower_splat(ssa::Instruction &instr);
 };
 
 } // namespace codegen
@@ -8,12 +8,6 @@
 
 namespace banjo::codegen {
 
-void StackFramePass::run(mcode::Module &mod) {
-    for (mcode::Function *func : mod.get_functions()) {
-        run(*func);
-    }
-}
-
 void StackFramePass::run(mcode::Function &func) {
     PROFILE_SCOPE("stack frame builder");
 
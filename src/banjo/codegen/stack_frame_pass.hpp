@@ -13,8 +13,7 @@ private:
     mcode::Function *func;
 
 public:
-    void run(mcode::Module &mod);
-    void run(mcode::Function &func);
+    void run(mcode::Function &func) override;
 
 private:
     void create_generic_region(int &generic_region_size, std::unordered_map<int, int> &pre_alloca_offsets, int top);
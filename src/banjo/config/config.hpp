@@ -21,6 +21,10 @@ struct Config {
     bool force_asm = false;
     bool disable_std = false;
     bool debug = false;
+    unsigned num_jobs = 1;
+    std::optional<std::filesystem::path> cache_dir;
+    unsigned cache_size_limit = 256;
+    bool cache_stats = false;
     std::vector<std::filesystem::path> paths;
     std::optional<target::CodeModel> code_model;
 
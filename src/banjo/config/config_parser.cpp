@@ -1,6 +1,8 @@
 #include "config_parser.hpp"
 #include "banjo/target/target_description.hpp"
 
+#include <algorithm>
+
 namespace banjo {
 
 static const std::string ARG_ARCH = "arch";
@@ -18,6 +20,10 @@ static const std::string ARG_FORCE_ASM = "force-asm";
 static const std::string ARG_DISABLE_STD = "disable-std";
 static const std::string ARG_DEBUG = "debug";
 static const std::string ARG_PATH = "path";
+static const std::string ARG_JOBS = "jobs";
+static const std::string ARG_CACHE_DIR = "cache-dir";
+static const std::string ARG_CACHE_SIZE_LIMIT = "cache-size-limit";
+static const std::string ARG_CACHE_STATS = "cache-stats";
 
 ConfigParser::ConfigParser() {
     arg_parser.add_value(ARG_ARCH, "x86_64")
@@ -34,7 +40,11 @@ ConfigParser::ConfigParser() {
         .add_flag(ARG_FORCE_ASM)
         .add_flag(ARG_DISABLE_STD)
         .add_flag(ARG_DEBUG)
-        .add_list(ARG_PATH);
+        .add_list(ARG_PATH)
+        .add_value(ARG_JOBS, "1")
+        .add_value(ARG_CACHE_DIR, "")
+        .add_value(ARG_CACHE_SIZE_LIMIT, "256")
+        .add_flag(ARG_CACHE_STATS);
 }
 
 Config ConfigParser::parse(int argc, char **argv) {
@@ -54,6 +64,14 @@ Config ConfigParser::create_config(const ParsedArgs &args) {
     config.force_asm = args.flags.at(ARG_FORCE_ASM);
     config.disable_std = args.flags.at(ARG_DISABLE_STD);
     config.debug = args.flags.at(ARG_DEBUG);
+    config.num_jobs = std::max(std::stoi(args.values.at(ARG_JOBS)), 1);
+    config.cache_size_limit = std::max(std::stoi(args.values.at(ARG_CACHE_SIZE_LIMIT)), 0);
+    config.cache_stats = args.flags.at(ARG_CACHE_STATS);
+
+    const std::string &cache_dir = args.values.at(ARG_CACHE_DIR);
+    if (!cache_dir.empty()) {
+        config.cache_dir = cache_dir;
+    }
 
     const std::string &code_model = args.values.at(ARG_CODE_MODEL);
     if (code_model == "small") config.code_model = {target::CodeModel::SMALL};
@@ -87,6 +87,25 @@ const std::unordered_map<mcode::Opcode, std::string> NASMEmitter::OPCODE_NAMES =
     {target::X8664Opcode::CVTSS2SI, "cvtss2si"},
     {target::X8664Opcode::CVTSI2SD, "cvtsi2sd"},
     {target::X8664Opcode::CVTSD2SI, "cvtsd2si"},
+    {target::X8664Opcode::ADDPS, "addps"},
+    {target::X8664Opcode::ADDPD, "addpd"},
+    {target::X8664Opcode::SUBPS, "subps"},
+    {target::X8664Opcode::SUBPD, "subpd"},
+    {target::X8664Opcode::MULPS, "mulps"},
+    {target::X8664Opcode::MULPD, "mulpd"},
+    {target::X8664Opcode::DIVPS, "divps"},
+    {target::X8664Opcode::DIVPD, "divpd"},
+    {target::X8664Opcode::PADDD, "paddd"},
+    {target::X8664Opcode::PSUBD, "psubd"},
+    {target::X8664Opcode::PMULLD, "pmulld"},
+    {target::X8664Opcode::SHUFPS, "shufps"},
+    {target::X8664Opcode::SHUFPD, "shufpd"},
+    {target::X8664Opcode::PSHUFD, "pshufd"},
+    {target::X8664Opcode::CMPPS, "cmpps"},
+    {target::X8664Opcode::CMPPD, "cmppd"},
+    {target::X8664Opcode::PCMPEQD, "pcmpeqd"},
+    {target::X8664Opcode::MOVMSKPS, "movmskps"},
+    {target::X8664Opcode::MOVMSKPD, "movmskpd"},
 
     {mcode::PseudoOpcode::EH_PUSHREG, ".eh_pushreg"},
     {mcode::PseudoOpcode::EH_ALLOCSTACK, ".eh_allocstack"},
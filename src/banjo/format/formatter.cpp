@@ -167,6 +167,9 @@ void Formatter::format_node(ASTNode *node, WhitespaceKind whitespace) {
         case AST_U64: format_single_token_node(node, whitespace); break;
         case AST_F32: format_single_token_node(node, whitespace); break;
         case AST_F64: format_single_token_node(node, whitespace); break;
+        case AST_F32X4: format_single_token_node(node, whitespace); break;
+        case AST_F64X2: format_single_token_node(node, whitespace); break;
+        case AST_I32X4: format_single_token_node(node, whitespace); break;
         case AST_USIZE: format_single_token_node(node, whitespace); break;
         case AST_BOOL: format_single_token_node(node, whitespace); break;
         case AST_ADDR: format_single_token_node(node, whitespace); break;
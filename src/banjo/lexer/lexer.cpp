@@ -23,7 +23,7 @@ const std::map<std::string_view, TokenType> KEYWORDS{
     {"union", TKN_UNION},   {"case", TKN_CASE},     {"proto", TKN_PROTO},   {"false", TKN_FALSE},
     {"true", TKN_TRUE},     {"null", TKN_NULL},     {"none", TKN_NONE},     {"undefined", TKN_UNDEFINED},
     {"use", TKN_USE},       {"pub", TKN_PUB},       {"native", TKN_NATIVE}, {"meta", TKN_META},
-    {"type", TKN_TYPE},
+    {"type", TKN_TYPE},     {"f32x4", TKN_F32X4},   {"f64x2", TKN_F64X2},   {"i32x4", TKN_I32X4},
 };
 
 Lexer::Lexer(const SourceFile &file, Mode mode /*= Mode::COMPILATION*/) : reader{file}, mode(mode) {}
@@ -29,6 +29,9 @@ enum TokenType : std::uint8_t {
     TKN_U64,
     TKN_F32,
     TKN_F64,
+    TKN_F32X4,
+    TKN_F64X2,
+    TKN_I32X4,
     TKN_USIZE,
     TKN_BOOL,
     TKN_ADDR,
@@ -26,6 +26,7 @@ private:
     std::vector<BasicBlockIter> successors;
     BasicBlockIter domtree_parent;
     std::vector<BasicBlockIter> domtree_children;
+    unsigned loop_depth = 0;
     Function *func;
 
 public:
@@ -41,6 +42,7 @@ public:
     std::vector<BasicBlockIter> &get_successors() { return successors; }
     BasicBlockIter get_domtree_parent() { return domtree_parent; }
     std::vector<BasicBlockIter> &get_domtree_children() { return domtree_children; }
+    unsigned get_loop_depth() { return loop_depth; }
     Function *get_func() { return func; }
 
     InstrIter append(Instruction instr);
@@ -50,6 +52,7 @@ public:
     InstrIter replace(InstrIter iter, Instruction instr);
 
     void set_domtree_parent(BasicBlockIter iter) { domtree_parent = iter; }
+    void set_loop_depth(unsigned loop_depth) { this->loop_depth = loop_depth; }
 
     InstrIter begin() { return instrs.begin(); }
     InstrIter end() { return instrs.end(); }
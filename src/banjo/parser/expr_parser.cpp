@@ -229,6 +229,9 @@ ParseResult ExprParser::parse_operand() {
         case TKN_U64: return parser.consume_into_node(AST_U64);
         case TKN_F32: return parser.consume_into_node(AST_F32);
         case TKN_F64: return parser.consume_into_node(AST_F64);
+        case TKN_F32X4: return parser.consume_into_node(AST_F32X4);
+        case TKN_F64X2: return parser.consume_into_node(AST_F64X2);
+        case TKN_I32X4: return parser.consume_into_node(AST_I32X4);
         case TKN_USIZE: return parser.consume_into_node(AST_USIZE);
         case TKN_BOOL: return parser.consume_into_node(AST_BOOL);
         case TKN_ADDR: return parser.consume_into_node(AST_ADDR);
@@ -82,6 +82,9 @@ void ControlFlowOptPass::run_iteration(ssa::Function &func) {
             try_inline_into_cjmp(block, target_true);
             try_inline_into_cjmp(block, target_false);
         }
+
+        // The branch targets and their arguments were rewritten in place.
+        block->update_def_use(block->get_exit_iter());
     }
 
     cfg = ssa::ControlFlowGraph{&func};
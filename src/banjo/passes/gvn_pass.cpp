@@ -0,0 +1,175 @@
+#include "gvn_pass.hpp"
+
+#include "banjo/passes/pass_utils.hpp"
+
+#include <utility>
+
+namespace banjo::passes {
+
+GVNPass::GVNPass(target::Target *target) : Pass("gvn", target) {}
+
+void GVNPass::run(ssa::Module &mod) {
+    for (ssa::Function *func : mod.get_functions()) {
+        run(*func);
+    }
+}
+
+void GVNPass::run(ssa::Function &func) {
+    ssa::ControlFlowGraph cfg(&func);
+    ssa::DominatorTree domtree(cfg);
+
+    values.clear();
+    run(func, domtree, cfg.get_entry_index());
+}
+
+void GVNPass::run(ssa::Function &func, ssa::DominatorTree &domtree, unsigned node_index) {
+    ssa::BasicBlockIter block = domtree.get_cfg().get_node(node_index).block;
+
+    // Values that become available in this block are only visible to the blocks it dominates, so they are removed
+    // from the table again once the subtree has been processed.
+    std::vector<const ValueKey *> scope_keys;
+
+    for (ssa::InstrIter iter = block->begin(); iter != block->end();) {
+        ssa::InstrIter next = iter.get_next();
+
+        bool numberable = iter->get_dest() && iter->get_attr() == ssa::Instruction::Attribute::NONE;
+
+        if (!numberable || !is_pure(iter->get_opcode())) {
+            iter = next;
+            continue;
+        }
+
+        ssa::VirtualRegister reg = *iter->get_dest();
+        auto [entry, inserted] = values.try_emplace(create_key(*iter), reg);
+
+        if (inserted) {
+            scope_keys.push_back(&entry->first);
+        } else {
+            if (is_logging()) {
+                log() << "replacing %" << reg << " with %" << entry->second << " in " << func.name << '\n';
+            }
+
+            block->remove(iter);
+            PassUtils::replace_in_func(func, reg, entry->second);
+        }
+
+        iter = next;
+    }
+
+    for (unsigned child_index : domtree.get_node(node_index).children_indices) {
+        run(func, domtree, child_index);
+    }
+
+    for (const ValueKey *key : scope_keys) {
+        values.erase(values.find(*key));
+    }
+}
+
+bool GVNPass::is_pure(ssa::Opcode opcode) {
+    switch (opcode) {
+        case ssa::Opcode::ADD:
+        case ssa::Opcode::SUB:
+        case ssa::Opcode::MUL:
+        case ssa::Opcode::SDIV:
+        case ssa::Opcode::SREM:
+        case ssa::Opcode::UDIV:
+        case ssa::Opcode::UREM:
+        case ssa::Opcode::FADD:
+        case ssa::Opcode::FSUB:
+        case ssa::Opcode::FMUL:
+        case ssa::Opcode::FDIV:
+        case ssa::Opcode::AND:
+        case ssa::Opcode::OR:
+        case ssa::Opcode::XOR:
+        case ssa::Opcode::LSHL:
+        case ssa::Opcode::LSHR:
+        case ssa::Opcode::ASHR:
+        case ssa::Opcode::SELECT:
+        case ssa::Opcode::UEXTEND:
+        case ssa::Opcode::SEXTEND:
+        case ssa::Opcode::TRUNCATE:
+        case ssa::Opcode::FPROMOTE:
+        case ssa::Opcode::FDEMOTE:
+        case ssa::Opcode::UTOF:
+        case ssa::Opcode::STOF:
+        case ssa::Opcode::FTOU:
+        case ssa::Opcode::FTOS:
+        case ssa::Opcode::MEMBERPTR:
+        case ssa::Opcode::OFFSETPTR:
+        case ssa::Opcode::SQRT:
+        case ssa::Opcode::SPLAT: return true;
+        default: return false;
+    }
+}
+
+bool GVNPass::is_commutative(ssa::Opcode opcode) {
+    switch (opcode) {
+        case ssa::Opcode::ADD:
+        case ssa::Opcode::MUL:
+        case ssa::Opcode::FADD:
+        case ssa::Opcode::FMUL:
+        case ssa::Opcode::AND:
+        case ssa::Opcode::OR:
+        case ssa::Opcode::XOR: return true;
+        default: return false;
+    }
+}
+
+GVNPass::ValueKey GVNPass::create_key(ssa::Instruction &instr) {
+    ValueKey key{
+        .opcode = instr.get_opcode(),
+        .operands = instr.get_operands(),
+    };
+
+    // Bring the operands of commutative instructions into a canonical order so that `a + b` and `b + a` get the
+    // same key. Registers come first, sorted by number.
+    if (is_commutative(key.opcode) && key.operands.size() == 2) {
+        ssa::Operand &lhs = key.operands[0];
+        ssa::Operand &rhs = key.operands[1];
+
+        if (lhs.is_register() ? rhs.is_register() && rhs.get_register() < lhs.get_register() : rhs.is_register()) {
+            std::swap(lhs, rhs);
+        }
+    }
+
+    return key;
+}
+
+bool GVNPass::ValueKey::operator==(const ValueKey &other) const {
+    if (opcode != other.opcode || operands.size() != other.operands.size()) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < operands.size(); i++) {
+        const ssa::Operand &operand = operands[i];
+        const ssa::Operand &other_operand = other.operands[i];
+
+        if (operand != other_operand || operand.get_type() != other_operand.get_type()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::size_t GVNPass::ValueKeyHash::operator()(const ValueKey &key) const {
+    std::size_t hash = static_cast<std::size_t>(key.opcode);
+
+    for (const ssa::Operand &operand : key.operands) {
+        std::size_t operand_hash;
+
+        if (operand.is_register()) {
+            operand_hash = operand.get_register();
+        } else if (operand.is_int_immediate()) {
+            operand_hash = static_cast<std::size_t>(operand.get_int_immediate().to_u64());
+        } else {
+            operand_hash = 0;
+        }
+
+        hash = hash * 31 + operand_hash;
+    }
+
+    return hash;
+}
+
+} // namespace banjo::passes
@@ -0,0 +1,54 @@
+#ifndef BANJO_PASSES_GVN_PASS_H
+#define BANJO_PASSES_GVN_PASS_H
+
+#include "banjo/passes/pass.hpp"
+#include "banjo/ssa/control_flow_graph.hpp"
+#include "banjo/ssa/instruction.hpp"
+#include "banjo/ssa/opcode.hpp"
+#include "banjo/ssa/virtual_register.hpp"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace banjo::passes {
+
+// Global value numbering: Walks the dominator tree and replaces pure instructions that compute a value that is
+// already available in a dominating block (or earlier in the same block) with the register of the earlier
+// instruction.
+class GVNPass : public Pass {
+
+private:
+    // Two instructions compute the same value if they have the same opcode and operands. Operand types are part of
+    // the key, so e.g. `memberptr` on different structs or casts to different types are never merged.
+    struct ValueKey {
+        ssa::Opcode opcode;
+        ssa::Instruction::OperandList operands;
+
+        bool operator==(const ValueKey &other) const;
+    };
+
+    struct ValueKeyHash {
+        std::size_t operator()(const ValueKey &key) const;
+    };
+
+    typedef std::unordered_map<ValueKey, ssa::VirtualRegister, ValueKeyHash> ValueTable;
+
+    ValueTable values;
+
+public:
+    GVNPass(target::Target *target);
+    void run(ssa::Module &mod);
+
+private:
+    void run(ssa::Function &func);
+    void run(ssa::Function &func, ssa::DominatorTree &domtree, unsigned node_index);
+
+    static bool is_pure(ssa::Opcode opcode);
+    static bool is_commutative(ssa::Opcode opcode);
+    static ValueKey create_key(ssa::Instruction &instr);
+};
+
+} // namespace banjo::passes
+
+#endif
@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #define DEBUG_LOG is_logging() && log()
@@ -79,7 +80,7 @@ void InliningPass::run(ssa::Function *func) {
 
 void InliningPass::try_inline(ssa::Function *func, ssa::BasicBlockIter &block_iter, ssa::InstrIter &call_iter) {
     ssa::Instruction &call_instr = *call_iter;
-    std::vector<ssa::Operand> call_operands = call_instr.get_operands();
+    ssa::Instruction::OperandList call_operands = call_instr.get_operands();
     ssa::Function *callee = call_instr.get_operand(0).get_func();
 
     DEBUG_LOG << "    ";
@@ -114,7 +115,7 @@ void InliningPass::inline_func(ssa::Function &func, ssa::BasicBlockIter &block_i
     ssa::Instruction &call_instr = *call_iter;
 
     std::optional<ssa::VirtualRegister> dst = call_instr.get_dest();
-    std::vector<ssa::Operand> call_operands = call_instr.get_operands();
+    ssa::Instruction::OperandList call_operands = call_instr.get_operands();
     ssa::Function &callee = *call_instr.get_operand(0).get_func();
 
     bool is_single_block = callee.get_basic_blocks().get_size() == 1;
@@ -187,7 +188,7 @@ void InliningPass::inline_func(ssa::Function &func, ssa::BasicBlockIter &block_i
                 }
             }
 
-            ssa::BasicBlockIter inline_block_iter = func.get_basic_blocks().insert_before(ctx.end_block, inline_block);
+            ssa::BasicBlockIter inline_block_iter = func.insert_before(ctx.end_block, std::move(inline_block));
             ctx.block_map.insert({iter, inline_block_iter});
         }
     } else {
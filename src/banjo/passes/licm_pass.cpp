@@ -81,7 +81,7 @@ void LICMPass::run(const ssa::LoopAnalysis &loop, ssa::ControlFlowGraph &cfg, ss
                 in_loop_defs.erase(*iter->get_dest());
 
                 ssa::InstrIter next_iter = iter.get_prev();
-                entry_block->get_instrs().insert_before(entry_block->get_instrs().get_last_iter(), *iter);
+                entry_block->insert_before(entry_block->get_exit_iter(), *iter);
                 block->remove(iter);
                 iter = next_iter;
 
@@ -87,7 +87,7 @@ bool LoopInversionPass::run(const ssa::LoopAnalysis &loop, ssa::ControlFlowGraph
     ssa::Instruction tail_cond_jump = *cond_jump_iter;
     tail_cond_jump.get_operand(3) = ssa::Operand::from_branch_target(new_true_target);
     tail_cond_jump.get_operand(4) = ssa::Operand::from_branch_target(false_target);
-    tail.get_instrs().replace(back_jump_iter, tail_cond_jump);
+    tail.replace(back_jump_iter, tail_cond_jump);
 
     // Copy all instructions of the header into the tail block.
     for (ssa::InstrIter iter = header_iter->begin(); iter != cond_jump_iter; ++iter) {
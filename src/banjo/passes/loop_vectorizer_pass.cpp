@@ -0,0 +1,794 @@
+#include "loop_vectorizer_pass.hpp"
+
+#include "banjo/passes/pass_utils.hpp"
+#include "banjo/ssa/comparison.hpp"
+#include "banjo/ssa/instruction.hpp"
+
+namespace banjo {
+
+namespace passes {
+
+LoopVectorizerPass::LoopVectorizerPass(target::Target *target) : Pass("loop-vectorizer", target) {}
+
+void LoopVectorizerPass::run(ssa::Module &mod) {
+    for (ssa::Function *func : mod.get_functions()) {
+        run(func);
+    }
+}
+
+void LoopVectorizerPass::run(ssa::Function *func) {
+    bool changed = true;
+
+    while (changed) {
+        changed = false;
+
+        ssa::ControlFlowGraph cfg(func);
+        ssa::DominatorTree domtree(cfg);
+        ssa::LoopAnalyzer analyzer(cfg, domtree);
+        std::vector<ssa::LoopAnalysis> loops = analyzer.analyze();
+
+        for (const ssa::LoopAnalysis &loop : loops) {
+            if (run(loop, cfg, func)) {
+                changed = true;
+                break;
+            }
+        }
+    }
+}
+
+bool LoopVectorizerPass::run(const ssa::LoopAnalysis &loop, ssa::ControlFlowGraph &cfg, ssa::Function *func) {
+    std::optional<LoopInfo> info = analyze(loop, cfg, func);
+    if (!info) {
+        return false;
+    }
+
+    if (is_logging()) {
+        log() << func->name << ": vectorizing " << info->header->get_debug_label() << " with width " << info->width
+              << '\n';
+    }
+
+    vectorize(*info, func);
+    epilogue_headers.insert(info->header);
+    return true;
+}
+
+std::optional<LoopVectorizerPass::LoopInfo> LoopVectorizerPass::analyze(
+    const ssa::LoopAnalysis &loop,
+    ssa::ControlFlowGraph &cfg,
+    ssa::Function *func
+) {
+    // Only loops consisting of a header with the exit condition and a single body block are vectorized.
+    if (loop.entries.size() != 1 || loop.exits.size() != 1 || loop.body.size() != 2) {
+        return {};
+    }
+
+    if (loop.exits.begin()->from != loop.header || loop.tail == loop.header) {
+        return {};
+    }
+
+    LoopInfo info;
+    info.header = cfg.get_node(loop.header).block;
+
+    if (epilogue_headers.contains(info.header)) {
+        return {};
+    }
+
+    info.entry = cfg.get_node(*loop.entries.begin()).block;
+    info.body = cfg.get_node(loop.tail).block;
+
+    // The vector loop is inserted between the entry block and the header, so the entry block has to jump to the
+    // header unconditionally.
+    ssa::Instruction &entry_jump = info.entry->get_instrs().get_last();
+    if (entry_jump.get_opcode() != ssa::Opcode::JMP) {
+        return {};
+    }
+
+    ssa::BranchTarget &entry_target = entry_jump.get_operand(0).get_branch_target();
+    if (entry_target.block != info.header) {
+        return {};
+    }
+
+    info.init_args = entry_target.args;
+
+    for (ssa::BasicBlockIter block : {info.header, info.body}) {
+        for (ssa::VirtualRegister param_reg : block->get_param_regs()) {
+            info.loop_defs.insert(param_reg);
+        }
+
+        for (ssa::Instruction &instr : block->get_instrs()) {
+            if (instr.get_dest()) {
+                info.loop_defs.insert(*instr.get_dest());
+            }
+        }
+    }
+
+    if (!analyze_header(info, cfg, loop) || !analyze_induction_var(info) || !analyze_body(info)) {
+        return {};
+    }
+
+    // Skip loops with a constant trip count that is too small for a single vector iteration.
+    ssa::Value &init = info.init_args[info.iv_index];
+
+    if (init.is_int_immediate() && info.bound.is_int_immediate()) {
+        LargeInt count = info.bound.get_int_immediate() - init.get_int_immediate();
+
+        if (count < LargeInt(info.width)) {
+            return {};
+        }
+    }
+
+    return info;
+}
+
+bool LoopVectorizerPass::analyze_header(LoopInfo &info, ssa::ControlFlowGraph &cfg, const ssa::LoopAnalysis &loop) {
+    if (info.header->get_size() != 1) {
+        return false;
+    }
+
+    ssa::Instruction &cond_jump = info.header->get_instrs().get_last();
+    if (cond_jump.get_opcode() != ssa::Opcode::CJMP) {
+        return false;
+    }
+
+    ssa::Value &lhs = cond_jump.get_operand(0);
+    ssa::Value &rhs = cond_jump.get_operand(2);
+    ssa::BranchTarget &true_target = cond_jump.get_operand(3).get_branch_target();
+    ssa::BranchTarget &false_target = cond_jump.get_operand(4).get_branch_target();
+
+    if (cond_jump.get_operand(1).get_comparison() != ssa::Comparison::ULT) {
+        return false;
+    }
+
+    if (true_target.block != info.body || !true_target.args.empty()) {
+        return false;
+    }
+
+    if (false_target.block != cfg.get_node(loop.exits.begin()->to).block) {
+        return false;
+    }
+
+    if (!lhs.is_register()) {
+        return false;
+    }
+
+    std::vector<ssa::VirtualRegister> &params = info.header->get_param_regs();
+
+    for (unsigned i = 0; i < params.size(); i++) {
+        if (lhs.is_register(params[i])) {
+            info.iv_index = i;
+            info.iv = params[i];
+            info.iv_type = info.header->get_param_types()[i];
+            break;
+        }
+
+        if (i == params.size() - 1) {
+            return false;
+        }
+    }
+
+    if (rhs.is_int_immediate() || (rhs.is_register() && !info.loop_defs.contains(rhs.get_register()))) {
+        info.bound = rhs;
+        return true;
+    }
+
+    return false;
+}
+
+bool LoopVectorizerPass::analyze_induction_var(LoopInfo &info) {
+    ssa::Instruction &back_jump = info.body->get_instrs().get_last();
+    if (back_jump.get_opcode() != ssa::Opcode::JMP) {
+        return false;
+    }
+
+    std::vector<ssa::Value> &back_args = back_jump.get_operand(0).get_branch_target().args;
+    std::vector<ssa::VirtualRegister> &params = info.header->get_param_regs();
+
+    for (unsigned i = 0; i < params.size(); i++) {
+        if (!back_args[i].is_register()) {
+            return false;
+        }
+
+        ssa::InstrIter def_iter = info.body->end();
+
+        for (ssa::InstrIter iter = info.body->begin(); iter != info.body->end(); ++iter) {
+            if (iter->get_dest() == back_args[i].get_register()) {
+                def_iter = iter;
+                break;
+            }
+        }
+
+        if (def_iter == info.body->end() || def_iter->get_opcode() != ssa::Opcode::ADD) {
+            return false;
+        }
+
+        ssa::Value &lhs = def_iter->get_operand(0);
+        ssa::Value &rhs = def_iter->get_operand(1);
+
+        if (i == info.iv_index) {
+            if (!lhs.is_register(info.iv) || !rhs.is_int_immediate() || rhs.get_int_immediate() != 1) {
+                return false;
+            }
+
+            info.iv_update = *def_iter->get_dest();
+        } else {
+            // Other header parameters have to be integer sums. Floating-point sums are not reassociated because
+            // that would change the result.
+            if (!lhs.is_register(params[i]) && !rhs.is_register(params[i])) {
+                return false;
+            }
+
+            if (!set_elem_type(info, info.header->get_param_types()[i])) {
+                return false;
+            }
+
+            info.reductions.push_back(
+                Reduction{
+                    .param_index = i,
+                    .param = params[i],
+                    .update = *def_iter->get_dest(),
+                }
+            );
+        }
+    }
+
+    return true;
+}
+
+bool LoopVectorizerPass::analyze_body(LoopInfo &info) {
+    std::unordered_map<ssa::VirtualRegister, ssa::VirtualRegister> addrs;
+    std::unordered_set<ssa::VirtualRegister> vector_values;
+    std::unordered_set<ssa::VirtualRegister> used_reductions;
+
+    auto is_vectorizable = [&info, &vector_values](ssa::Value &value) {
+        if (value.get_type() != info.elem_type) {
+            return false;
+        } else if (value.is_immediate()) {
+            return true;
+        } else if (value.is_register()) {
+            ssa::VirtualRegister reg = value.get_register();
+            return vector_values.contains(reg) || !info.loop_defs.contains(reg);
+        } else {
+            return false;
+        }
+    };
+
+    auto find_reduction = [&info](ssa::Value &value) -> Reduction * {
+        for (Reduction &reduction : info.reductions) {
+            if (value.is_register(reduction.param)) {
+                return &reduction;
+            }
+        }
+
+        return nullptr;
+    };
+
+    for (ssa::Instruction &instr : info.body->get_instrs()) {
+        if (instr.get_dest() == info.iv_update || instr.get_opcode() == ssa::Opcode::JMP) {
+            continue;
+        }
+
+        switch (instr.get_opcode()) {
+            case ssa::Opcode::OFFSETPTR: {
+                ssa::Value &base = instr.get_operand(0);
+
+                if (!base.is_register() || info.loop_defs.contains(base.get_register())) {
+                    return false;
+                }
+
+                if (!instr.get_operand(1).is_register(info.iv)) {
+                    return false;
+                }
+
+                if (!set_elem_type(info, instr.get_operand(2).get_type())) {
+                    return false;
+                }
+
+                addrs.insert({*instr.get_dest(), base.get_register()});
+                break;
+            }
+            case ssa::Opcode::LOAD: {
+                ssa::Value &addr = instr.get_operand(1);
+
+                if (!set_elem_type(info, instr.get_operand(0).get_type())) {
+                    return false;
+                }
+
+                if (!addr.is_register() || !addrs.contains(addr.get_register())) {
+                    return false;
+                }
+
+                info.load_bases.push_back(addrs.at(addr.get_register()));
+                vector_values.insert(*instr.get_dest());
+                break;
+            }
+            case ssa::Opcode::STORE: {
+                ssa::Value &addr = instr.get_operand(1);
+
+                if (!set_elem_type(info, instr.get_operand(0).get_type())) {
+                    return false;
+                }
+
+                if (!is_vectorizable(instr.get_operand(0))) {
+                    return false;
+                }
+
+                if (!addr.is_register() || !addrs.contains(addr.get_register())) {
+                    return false;
+                }
+
+                info.store_bases.push_back(addrs.at(addr.get_register()));
+                break;
+            }
+            case ssa::Opcode::ADD:
+            case ssa::Opcode::SUB:
+            case ssa::Opcode::MUL:
+            case ssa::Opcode::FADD:
+            case ssa::Opcode::FSUB:
+            case ssa::Opcode::FMUL:
+            case ssa::Opcode::FDIV: {
+                bool is_fp_opcode = instr.get_opcode() == ssa::Opcode::FADD ||
+                                    instr.get_opcode() == ssa::Opcode::FSUB ||
+                                    instr.get_opcode() == ssa::Opcode::FMUL || instr.get_opcode() == ssa::Opcode::FDIV;
+
+                if (!set_elem_type(info, instr.get_operand(0).get_type())) {
+                    return false;
+                }
+
+                if (is_fp_opcode != info.elem_type.is_floating_point()) {
+                    return false;
+                }
+
+                ssa::Value &lhs = instr.get_operand(0);
+                ssa::Value &rhs = instr.get_operand(1);
+
+                // The parameter of a reduction may only be used by the instruction that updates it.
+                Reduction *reduction = find_reduction(lhs);
+                ssa::Value *other = &rhs;
+
+                if (!reduction) {
+                    reduction = find_reduction(rhs);
+                    other = &lhs;
+                }
+
+                if (reduction) {
+                    if (reduction->update != *instr.get_dest() || used_reductions.contains(reduction->param)) {
+                        return false;
+                    }
+
+                    if (!is_vectorizable(*other)) {
+                        return false;
+                    }
+
+                    used_reductions.insert(reduction->param);
+                    break;
+                }
+
+                if (!is_vectorizable(lhs) || !is_vectorizable(rhs)) {
+                    return false;
+                }
+
+                vector_values.insert(*instr.get_dest());
+                break;
+            }
+            default: return false;
+        }
+    }
+
+    if (used_reductions.size() != info.reductions.size()) {
+        return false;
+    }
+
+    // Addresses may only be used as the address operand of loads and stores, and the updated induction variable and
+    // reductions may only be passed back to the header.
+    for (ssa::Instruction &instr : info.body->get_instrs()) {
+        ssa::Instruction::OperandList &operands = instr.get_operands();
+
+        if (instr.get_opcode() == ssa::Opcode::JMP) {
+            continue;
+        }
+
+        for (unsigned i = 0; i < operands.size(); i++) {
+            if (!operands[i].is_register()) {
+                continue;
+            }
+
+            ssa::VirtualRegister reg = operands[i].get_register();
+            bool is_addr_operand = i == 1 && (instr.get_opcode() == ssa::Opcode::LOAD ||
+                                              instr.get_opcode() == ssa::Opcode::STORE);
+
+            if (addrs.contains(reg) && !is_addr_operand) {
+                return false;
+            }
+
+            if (reg == info.iv_update) {
+                return false;
+            }
+
+            for (Reduction &reduction : info.reductions) {
+                if (reg == reduction.update) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return info.elem_type.get_primitive() != ssa::Primitive::VOID;
+}
+
+bool LoopVectorizerPass::set_elem_type(LoopInfo &info, ssa::Type type) {
+    if (info.elem_type.get_primitive() != ssa::Primitive::VOID) {
+        return type == info.elem_type;
+    }
+
+    if (type.get_array_length() != 1) {
+        return false;
+    }
+
+    if (type.is_primitive(ssa::Primitive::F32)) {
+        info.vector_type = ssa::Primitive::F32X4;
+        info.width = 4;
+    } else if (type.is_primitive(ssa::Primitive::F64)) {
+        info.vector_type = ssa::Primitive::F64X2;
+        info.width = 2;
+    } else if (type.is_primitive(ssa::Primitive::I32) || type.is_primitive(ssa::Primitive::U32)) {
+        info.vector_type = ssa::Primitive::I32X4;
+        info.width = 4;
+    } else {
+        return false;
+    }
+
+    info.elem_type = type;
+    return true;
+}
+
+void LoopVectorizerPass::vectorize(LoopInfo &loop, ssa::Function *func) {
+    ssa::Value &init = loop.init_args[loop.iv_index];
+
+    ssa::BasicBlockIter setup_block = func->insert_after(loop.entry);
+    ssa::BasicBlockIter vector_header = func->insert_after(setup_block);
+    ssa::BasicBlockIter vector_body = func->insert_after(vector_header);
+    ssa::BasicBlockIter vector_exit = func->insert_after(vector_body);
+    ssa::BasicBlockIter first_block = setup_block;
+
+    // Skip the vector loop if the scalar loop isn't entered at all because the trip count below would wrap.
+    if (!init.is_int_immediate() || !loop.bound.is_int_immediate()) {
+        first_block = func->insert_after(loop.entry);
+
+        bool is_init_reg = init.is_register();
+        ssa::Comparison cmp = is_init_reg ? ssa::Comparison::ULT : ssa::Comparison::UGT;
+
+        first_block->append(
+            ssa::Instruction(
+                ssa::Opcode::CJMP,
+                {
+                    is_init_reg ? init : loop.bound,
+                    ssa::Value::from_comparison(cmp),
+                    is_init_reg ? loop.bound : init,
+                    ssa::Value::from_branch_target({.block = setup_block, .args = {}}),
+                    ssa::Value::from_branch_target(get_scalar_target(loop)),
+                }
+            )
+        );
+    }
+
+    // The vector loop runs up to `bound - (bound - init) % width`.
+    ssa::Value vector_end;
+
+    if (init.is_int_immediate() && loop.bound.is_int_immediate()) {
+        LargeInt count = loop.bound.get_int_immediate() - init.get_int_immediate();
+        LargeInt remainder = count % LargeInt(loop.width);
+        vector_end = ssa::Value::from_int_immediate(loop.bound.get_int_immediate() - remainder, loop.iv_type);
+    } else {
+        ssa::VirtualRegister count_reg = func->next_virtual_reg();
+        ssa::VirtualRegister remainder_reg = func->next_virtual_reg();
+        ssa::VirtualRegister vector_end_reg = func->next_virtual_reg();
+
+        ssa::Value count = ssa::Value::from_register(count_reg, loop.iv_type);
+        ssa::Value remainder = ssa::Value::from_register(remainder_reg, loop.iv_type);
+        ssa::Value mask = ssa::Value::from_int_immediate(loop.width - 1, loop.iv_type);
+
+        setup_block->append(ssa::Instruction(ssa::Opcode::SUB, count_reg, {loop.bound, init}));
+        setup_block->append(ssa::Instruction(ssa::Opcode::AND, remainder_reg, {count, mask}));
+        setup_block->append(ssa::Instruction(ssa::Opcode::SUB, vector_end_reg, {loop.bound, remainder}));
+
+        vector_end = ssa::Value::from_register(vector_end_reg, loop.iv_type);
+    }
+
+    VectorizationContext ctx{
+        .loop = loop,
+        .func = func,
+        .setup_block = setup_block,
+        .values = {},
+        .splats = {},
+    };
+
+    // The header of the vector loop takes the induction variable and one vector accumulator per reduction.
+    ssa::VirtualRegister vector_iv = func->next_virtual_reg();
+    ssa::Value vector_iv_value = ssa::Value::from_register(vector_iv, loop.iv_type);
+    vector_header->get_param_regs().push_back(vector_iv);
+    vector_header->get_param_types().push_back(loop.iv_type);
+
+    std::vector<ssa::Value> vector_init_args{init};
+
+    for (Reduction &reduction : loop.reductions) {
+        ssa::VirtualRegister accumulator = func->next_virtual_reg();
+        vector_header->get_param_regs().push_back(accumulator);
+        vector_header->get_param_types().push_back(loop.vector_type);
+        ctx.values.insert({reduction.param, ssa::Value::from_register(accumulator, loop.vector_type)});
+        vector_init_args.push_back(ssa::Value::from_int_immediate(0, loop.vector_type));
+    }
+
+    vector_header->append(
+        ssa::Instruction(
+            ssa::Opcode::CJMP,
+            {
+                vector_iv_value,
+                ssa::Value::from_comparison(ssa::Comparison::ULT),
+                vector_end,
+                ssa::Value::from_branch_target({.block = vector_body, .args = {}}),
+                ssa::Value::from_branch_target({.block = vector_exit, .args = {}}),
+            }
+        )
+    );
+
+    ctx.values.insert({loop.iv, vector_iv_value});
+    emit_vector_body(ctx, vector_body);
+
+    ssa::VirtualRegister vector_iv_update = func->next_virtual_reg();
+    ssa::Value width = ssa::Value::from_int_immediate(loop.width, loop.iv_type);
+    vector_body->append(ssa::Instruction(ssa::Opcode::ADD, vector_iv_update, {vector_iv_value, width}));
+
+    std::vector<ssa::Value> back_args{ssa::Value::from_register(vector_iv_update, loop.iv_type)};
+
+    for (Reduction &reduction : loop.reductions) {
+        back_args.push_back(ctx.values.at(reduction.update));
+    }
+
+    ssa::BranchTarget back_target{.block = vector_header, .args = back_args};
+    vector_body->append(ssa::Instruction(ssa::Opcode::JMP, {ssa::Value::from_branch_target(back_target)}));
+
+    // Sum up the lanes of the vector accumulators and continue with the scalar loop for the remaining iterations.
+    std::vector<ssa::Value> scalar_args = loop.init_args;
+    scalar_args[loop.iv_index] = vector_end;
+
+    ssa::BasicBlock &func_entry = func->get_entry_block();
+
+    for (unsigned i = 0; i < loop.reductions.size(); i++) {
+        Reduction &reduction = loop.reductions[i];
+
+        ssa::VirtualRegister slot = func->next_virtual_reg();
+        ssa::Value slot_value = ssa::Value::from_register(slot, ssa::Primitive::ADDR);
+        ssa::Value slot_type = ssa::Value::from_type(ssa::Type(loop.elem_type.get_primitive(), loop.width));
+        func_entry.insert_before(func_entry.begin(), ssa::Instruction(ssa::Opcode::ALLOCA, slot, {slot_type}));
+
+        ssa::Value accumulator = ssa::Value::from_register(vector_header->get_param_regs()[i + 1], loop.vector_type);
+        vector_exit->append(ssa::Instruction(ssa::Opcode::STORE, {accumulator, slot_value}));
+
+        ssa::Value sum = loop.init_args[reduction.param_index];
+
+        for (unsigned lane = 0; lane < loop.width; lane++) {
+            ssa::VirtualRegister lane_ptr = func->next_virtual_reg();
+            ssa::VirtualRegister lane_val = func->next_virtual_reg();
+            ssa::VirtualRegister new_sum = func->next_virtual_reg();
+
+            ssa::Value lane_index = ssa::Value::from_int_immediate(lane, ssa::Primitive::I64);
+            ssa::Value elem_type = ssa::Value::from_type(loop.elem_type);
+            ssa::Value lane_ptr_value = ssa::Value::from_register(lane_ptr, ssa::Primitive::ADDR);
+            ssa::Value lane_val_value = ssa::Value::from_register(lane_val, loop.elem_type);
+
+            vector_exit->append(
+                ssa::Instruction(ssa::Opcode::OFFSETPTR, lane_ptr, {slot_value, lane_index, elem_type})
+            );
+            vector_exit->append(ssa::Instruction(ssa::Opcode::LOAD, lane_val, {elem_type, lane_ptr_value}));
+            vector_exit->append(ssa::Instruction(ssa::Opcode::ADD, new_sum, {sum, lane_val_value}));
+
+            sum = ssa::Value::from_register(new_sum, loop.elem_type);
+        }
+
+        scalar_args[reduction.param_index] = sum;
+    }
+
+    ssa::BranchTarget scalar_target{.block = loop.header, .args = scalar_args};
+    vector_exit->append(ssa::Instruction(ssa::Opcode::JMP, {ssa::Value::from_branch_target(scalar_target)}));
+
+    // The alias checks are inserted between the setup block and the vector header.
+    ssa::BranchTarget vector_target{.block = vector_header, .args = vector_init_args};
+    ssa::BranchTarget setup_target = emit_alias_checks(loop, func, setup_block, vector_target);
+    setup_block->append(ssa::Instruction(ssa::Opcode::JMP, {ssa::Value::from_branch_target(setup_target)}));
+
+    ssa::BranchTarget entry_target{.block = first_block, .args = {}};
+    loop.entry->get_instrs().get_last().get_operand(0) = ssa::Value::from_branch_target(entry_target);
+}
+
+ssa::BranchTarget LoopVectorizerPass::emit_alias_checks(
+    LoopInfo &loop,
+    ssa::Function *func,
+    ssa::BasicBlockIter after,
+    ssa::BranchTarget success_target
+) {
+    std::vector<std::pair<ssa::VirtualRegister, ssa::VirtualRegister>> pairs;
+
+    std::vector<ssa::VirtualRegister> bases = loop.store_bases;
+    bases.insert(bases.end(), loop.load_bases.begin(), loop.load_bases.end());
+
+    for (ssa::VirtualRegister store_base : loop.store_bases) {
+        for (ssa::VirtualRegister base : bases) {
+            if (base == store_base || is_known_distinct(func, store_base, base)) {
+                continue;
+            }
+
+            bool is_duplicate = false;
+
+            for (const auto &[a, b] : pairs) {
+                if ((a == store_base && b == base) || (a == base && b == store_base)) {
+                    is_duplicate = true;
+                    break;
+                }
+            }
+
+            if (!is_duplicate) {
+                pairs.push_back({store_base, base});
+            }
+        }
+    }
+
+    // Two accesses of `width` elements overlap if the distance between their bases is less than the size of a vector
+    // in either direction. Bases that are equal are fine because every iteration only accesses its own element.
+    unsigned elem_size = loop.elem_type.is_primitive(ssa::Primitive::F64) ? 8 : 4;
+    LargeInt vector_size = loop.width * elem_size;
+
+    ssa::Type u64_type = ssa::Primitive::U64;
+    ssa::BranchTarget next_target = success_target;
+
+    // The checks are emitted in reverse so every check knows the block to continue with.
+    for (auto iter = pairs.rbegin(); iter != pairs.rend(); ++iter) {
+        ssa::BasicBlockIter check_block = func->insert_after(after);
+        ssa::BasicBlockIter equal_block = func->insert_after(check_block);
+
+        ssa::VirtualRegister distance_reg = func->next_virtual_reg();
+        ssa::VirtualRegister biased_reg = func->next_virtual_reg();
+        ssa::Value distance = ssa::Value::from_register(distance_reg, u64_type);
+        ssa::Value biased = ssa::Value::from_register(biased_reg, u64_type);
+
+        ssa::Value lhs = ssa::Value::from_register(iter->first, u64_type);
+        ssa::Value rhs = ssa::Value::from_register(iter->second, u64_type);
+        ssa::Value bias = ssa::Value::from_int_immediate(vector_size - 1, u64_type);
+        ssa::Value limit = ssa::Value::from_int_immediate(2 * vector_size - 1, u64_type);
+
+        check_block->append(ssa::Instruction(ssa::Opcode::SUB, distance_reg, {lhs, rhs}));
+        check_block->append(ssa::Instruction(ssa::Opcode::ADD, biased_reg, {distance, bias}));
+        check_block->append(
+            ssa::Instruction(
+                ssa::Opcode::CJMP,
+                {
+                    biased,
+                    ssa::Value::from_comparison(ssa::Comparison::UGE),
+                    limit,
+                    ssa::Value::from_branch_target(next_target),
+                    ssa::Value::from_branch_target({.block = equal_block, .args = {}}),
+                }
+            )
+        );
+
+        equal_block->append(
+            ssa::Instruction(
+                ssa::Opcode::CJMP,
+                {
+                    distance,
+                    ssa::Value::from_comparison(ssa::Comparison::EQ),
+                    ssa::Value::from_int_immediate(0, u64_type),
+                    ssa::Value::from_branch_target(next_target),
+                    ssa::Value::from_branch_target(get_scalar_target(loop)),
+                }
+            )
+        );
+
+        next_target = {.block = check_block, .args = {}};
+    }
+
+    return next_target;
+}
+
+void LoopVectorizerPass::emit_vector_body(VectorizationContext &ctx, ssa::BasicBlockIter block) {
+    LoopInfo &loop = ctx.loop;
+
+    for (ssa::Instruction &instr : loop.body->get_instrs()) {
+        if (instr.get_dest() == loop.iv_update || instr.get_opcode() == ssa::Opcode::JMP) {
+            continue;
+        }
+
+        ssa::VirtualRegister dest = ctx.func->next_virtual_reg();
+
+        switch (instr.get_opcode()) {
+            case ssa::Opcode::OFFSETPTR: {
+                ssa::Value index = ctx.values.at(loop.iv);
+                block->append(
+                    ssa::Instruction(ssa::Opcode::OFFSETPTR, dest, {instr.get_operand(0), index, instr.get_operand(2)})
+                );
+                ctx.values.insert({*instr.get_dest(), ssa::Value::from_register(dest, ssa::Primitive::ADDR)});
+                break;
+            }
+            case ssa::Opcode::LOAD: {
+                ssa::Value addr = ctx.values.at(instr.get_operand(1).get_register());
+                ssa::Value type = ssa::Value::from_type(loop.vector_type);
+                block->append(ssa::Instruction(ssa::Opcode::LOAD, dest, {type, addr}));
+                ctx.values.insert({*instr.get_dest(), ssa::Value::from_register(dest, loop.vector_type)});
+                break;
+            }
+            case ssa::Opcode::STORE: {
+                ssa::Value value = vectorize_value(ctx, instr.get_operand(0));
+                ssa::Value addr = ctx.values.at(instr.get_operand(1).get_register());
+                block->append(ssa::Instruction(ssa::Opcode::STORE, {value, addr}));
+                break;
+            }
+            default: {
+                ssa::Value lhs = vectorize_value(ctx, instr.get_operand(0));
+                ssa::Value rhs = vectorize_value(ctx, instr.get_operand(1));
+                block->append(ssa::Instruction(instr.get_opcode(), dest, {lhs, rhs}));
+                ctx.values.insert({*instr.get_dest(), ssa::Value::from_register(dest, loop.vector_type)});
+                break;
+            }
+        }
+    }
+}
+
+ssa::Value LoopVectorizerPass::vectorize_value(VectorizationContext &ctx, ssa::Value &value) {
+    if (value.is_register()) {
+        auto iter = ctx.values.find(value.get_register());
+        if (iter != ctx.values.end()) {
+            return iter->second;
+        }
+    }
+
+    // Values that are invariant in the loop are splatted into a vector once before entering the vector loop.
+    for (const auto &[scalar, splat] : ctx.splats) {
+        if (scalar == value) {
+            return ssa::Value::from_register(splat, ctx.loop.vector_type);
+        }
+    }
+
+    ssa::VirtualRegister splat = ctx.func->next_virtual_reg();
+    ssa::Value type = ssa::Value::from_type(ctx.loop.vector_type);
+    ctx.setup_block->append(ssa::Instruction(ssa::Opcode::SPLAT, splat, {value, type}));
+    ctx.splats.push_back({value, splat});
+
+    return ssa::Value::from_register(splat, ctx.loop.vector_type);
+}
+
+bool LoopVectorizerPass::is_known_distinct(ssa::Function *func, ssa::VirtualRegister a, ssa::VirtualRegister b) {
+    std::optional<ssa::VirtualRegister> root_a = find_alloca_root(func, a);
+    std::optional<ssa::VirtualRegister> root_b = find_alloca_root(func, b);
+    return root_a && root_b && *root_a != *root_b;
+}
+
+std::optional<ssa::VirtualRegister> LoopVectorizerPass::find_alloca_root(
+    ssa::Function *func,
+    ssa::VirtualRegister reg
+) {
+    while (true) {
+        ssa::InstrIter def = PassUtils::find_def(*func, reg);
+        if (!def) {
+            return {};
+        }
+
+        if (def->get_opcode() == ssa::Opcode::ALLOCA) {
+            return reg;
+        } else if (def->get_opcode() == ssa::Opcode::OFFSETPTR || def->get_opcode() == ssa::Opcode::MEMBERPTR) {
+            if (!def->get_operand(0).is_register()) {
+                return {};
+            }
+
+            reg = def->get_operand(0).get_register();
+        } else {
+            return {};
+        }
+    }
+}
+
+ssa::BranchTarget LoopVectorizerPass::get_scalar_target(LoopInfo &loop) {
+    return {.block = loop.header, .args = loop.init_args};
+}
+
+} // namespace passes
+
+} // namespace banjo
@@ -0,0 +1,99 @@
+#ifndef BANJO_PASSES_LOOP_VECTORIZER_PASS_H
+#define BANJO_PASSES_LOOP_VECTORIZER_PASS_H
+
+#include "banjo/passes/loop_analysis.hpp"
+#include "banjo/passes/pass.hpp"
+#include "banjo/ssa/basic_block.hpp"
+#include "banjo/ssa/operand.hpp"
+#include "banjo/ssa/type.hpp"
+#include "banjo/ssa/virtual_register.hpp"
+
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace banjo {
+
+namespace passes {
+
+// Vectorizes innermost counted loops of the form `for i in init..bound` whose body only performs element-wise
+// operations on `ptr[i]`. The vector loop processes the iterations in steps of the vector width and then jumps into
+// the original loop, which handles the remaining iterations as a scalar epilogue. If the pointers accessed by the
+// loop might overlap, a runtime check falls back to the scalar loop.
+class LoopVectorizerPass : public Pass {
+
+private:
+    struct Reduction {
+        unsigned param_index;
+        ssa::VirtualRegister param;
+        ssa::VirtualRegister update;
+    };
+
+    struct LoopInfo {
+        ssa::BasicBlockIter entry;
+        ssa::BasicBlockIter header;
+        ssa::BasicBlockIter body;
+
+        unsigned iv_index;
+        ssa::VirtualRegister iv;
+        ssa::VirtualRegister iv_update;
+        ssa::Type iv_type;
+        ssa::Value bound;
+        std::vector<ssa::Value> init_args;
+        std::unordered_set<ssa::VirtualRegister> loop_defs;
+
+        ssa::Type elem_type;
+        ssa::Type vector_type;
+        unsigned width;
+
+        std::vector<Reduction> reductions;
+        std::vector<ssa::VirtualRegister> load_bases;
+        std::vector<ssa::VirtualRegister> store_bases;
+    };
+
+    struct VectorizationContext {
+        LoopInfo &loop;
+        ssa::Function *func;
+        ssa::BasicBlockIter setup_block;
+        std::unordered_map<ssa::VirtualRegister, ssa::Value> values;
+        std::vector<std::pair<ssa::Value, ssa::VirtualRegister>> splats;
+    };
+
+    // Headers of loops that were already vectorized and are now the scalar epilogue of a vector loop.
+    std::unordered_set<ssa::BasicBlockIter> epilogue_headers;
+
+public:
+    LoopVectorizerPass(target::Target *target);
+    void run(ssa::Module &mod);
+
+private:
+    void run(ssa::Function *func);
+    bool run(const ssa::LoopAnalysis &loop, ssa::ControlFlowGraph &cfg, ssa::Function *func);
+
+    std::optional<LoopInfo> analyze(const ssa::LoopAnalysis &loop, ssa::ControlFlowGraph &cfg, ssa::Function *func);
+    bool analyze_header(LoopInfo &info, ssa::ControlFlowGraph &cfg, const ssa::LoopAnalysis &loop);
+    bool analyze_induction_var(LoopInfo &info);
+    bool analyze_body(LoopInfo &info);
+    bool set_elem_type(LoopInfo &info, ssa::Type type);
+
+    void vectorize(LoopInfo &loop, ssa::Function *func);
+    ssa::BranchTarget emit_alias_checks(
+        LoopInfo &loop,
+        ssa::Function *func,
+        ssa::BasicBlockIter after,
+        ssa::BranchTarget success_target
+    );
+    void emit_vector_body(VectorizationContext &ctx, ssa::BasicBlockIter block);
+    ssa::Value vectorize_value(VectorizationContext &ctx, ssa::Value &value);
+    bool is_known_distinct(ssa::Function *func, ssa::VirtualRegister a, ssa::VirtualRegister b);
+    std::optional<ssa::VirtualRegister> find_alloca_root(ssa::Function *func, ssa::VirtualRegister reg);
+    ssa::BranchTarget get_scalar_target(LoopInfo &loop);
+};
+
+} // namespace passes
+
+} // namespace banjo
+
+#endif
@@ -15,63 +15,95 @@ void PassUtils::replace_in_func(
     ssa::VirtualRegister old_register,
     ssa::VirtualRegister new_register
 ) {
-    for (ssa::BasicBlock &block : func) {
-        replace_in_block(block, old_register, new_register);
+    ssa::DefUseIndex &def_use = func.get_def_use_index();
+
+    for (ssa::InstrIter use : def_use.find_uses(old_register)) {
+        replace_in_instr(*use, old_register, new_register);
+        def_use.update_instr(use);
+    }
+
+    if (ssa::InstrIter def = def_use.find_def(old_register)) {
+        def->set_dest(new_register);
+        def_use.update_instr(def);
     }
 }
 
 void PassUtils::replace_in_block(ssa::BasicBlock &block, VirtualRegister old_register, VirtualRegister new_register) {
-    for (ssa::Instruction &instr : block.get_instrs()) {
-        if (instr.get_dest() && *instr.get_dest() == old_register) {
-            instr.set_dest(new_register);
-        }
+    for (ssa::InstrIter iter = block.begin(); iter != block.end(); ++iter) {
+        bool replaced = replace_in_instr(*iter, old_register, new_register);
 
-        for (Operand &operand : instr.get_operands()) {
-            if (operand.is_register() && operand.get_register() == old_register) {
-                operand.set_to_register(new_register);
-            }
+        if (iter->get_dest() && *iter->get_dest() == old_register) {
+            iter->set_dest(new_register);
+            replaced = true;
+        }
 
-            if (operand.is_branch_target()) {
-                for (ssa::Value &arg : operand.get_branch_target().args) {
-                    if (arg.is_register(old_register)) {
-                        arg.set_to_register(new_register);
-                    }
-                }
-            }
+        if (replaced) {
+            block.update_def_use(iter);
         }
     }
 }
 
 void PassUtils::replace_in_func(ssa::Function &func, ssa::VirtualRegister reg, ssa::Value value) {
-    for (ssa::BasicBlock &block : func) {
-        replace_in_block(block, reg, value);
+    ssa::DefUseIndex &def_use = func.get_def_use_index();
+
+    for (ssa::InstrIter use : def_use.find_uses(reg)) {
+        replace_in_instr(*use, reg, value);
+        def_use.update_instr(use);
     }
 }
 
 void PassUtils::replace_in_block(ssa::BasicBlock &block, VirtualRegister reg, Value value) {
-    replace_in_range(block.begin(), block.end(), reg, std::move(value));
+    for (ssa::InstrIter iter = block.begin(); iter != block.end(); ++iter) {
+        if (replace_in_instr(*iter, reg, value)) {
+            block.update_def_use(iter);
+        }
+    }
 }
 
-void PassUtils::replace_in_range(ssa::InstrIter start, ssa::InstrIter end, ssa::VirtualRegister reg, ssa::Value value) {
-    for (ssa::InstrIter iter = start; iter != end; ++iter) {
-        replace_in_instr(*iter, reg, value);
+bool PassUtils::replace_in_instr(
+    ssa::Instruction &instr,
+    ssa::VirtualRegister old_register,
+    ssa::VirtualRegister new_register
+) {
+    bool replaced = false;
+
+    for (Operand &operand : instr.get_operands()) {
+        if (operand.is_register(old_register)) {
+            operand.set_to_register(new_register);
+            replaced = true;
+        } else if (operand.is_branch_target()) {
+            for (ssa::Value &arg : operand.get_branch_target().args) {
+                if (arg.is_register(old_register)) {
+                    arg.set_to_register(new_register);
+                    replaced = true;
+                }
+            }
+        }
     }
+
+    return replaced;
 }
 
-void PassUtils::replace_in_instr(ssa::Instruction &instr, ssa::VirtualRegister reg, ssa::Value value) {
+bool PassUtils::replace_in_instr(ssa::Instruction &instr, ssa::VirtualRegister reg, ssa::Value value) {
     // FIXME: Why do we modify the type here? This seems dangerous...
 
+    bool replaced = false;
+
     for (Operand &operand : instr.get_operands()) {
         if (operand.is_register(reg)) {
             operand = value.with_type(operand.get_type());
+            replaced = true;
         } else if (operand.is_branch_target()) {
             for (ssa::Value &arg : operand.get_branch_target().args) {
                 if (arg.is_register(reg)) {
                     arg = value.with_type(arg.get_type());
+                    replaced = true;
                 }
             }
         }
     }
+
+    return replaced;
 }
 
 bool PassUtils::is_arith_opcode(ssa::Opcode opcode) {
@@ -82,7 +114,7 @@ bool PassUtils::is_branch_opcode(ssa::Opcode opcode) {
     return opcode == Opcode::JMP || opcode == Opcode::CJMP || opcode == Opcode::FCJMP;
 }
 
-void PassUtils::iter_values(std::vector<ssa::Operand> &operands, std::function<void(ssa::Value &value)> func) {
+void PassUtils::iter_values(std::span<ssa::Operand> operands, std::function<void(ssa::Value &value)> func) {
     for (ssa::Operand &operand : operands) {
         func(operand);
 
@@ -92,7 +124,7 @@ void PassUtils::iter_values(std::vector<ssa::Operand> &operands, std::function<v
     }
 }
 
-void PassUtils::iter_regs(std::vector<ssa::Operand> &operands, std::function<void(ssa::VirtualRegister reg)> func) {
+void PassUtils::iter_regs(std::span<ssa::Operand> operands, std::function<void(ssa::VirtualRegister reg)> func) {
     for (ssa::Operand &operand : operands) {
         if (operand.is_register()) {
             func(operand.get_register());
@@ -102,7 +134,7 @@ void PassUtils::iter_regs(std::vector<ssa::Operand> &operands, std::function<voi
     }
 }
 
-void PassUtils::iter_imms(std::vector<ssa::Operand> &operands, std::function<void(ssa::Value &val)> func) {
+void PassUtils::iter_imms(std::span<ssa::Operand> operands, std::function<void(ssa::Value &val)> func) {
     for (ssa::Operand &operand : operands) {
         if (operand.is_int_immediate() || operand.is_fp_immediate()) {
             func(operand);
@@ -129,28 +161,23 @@ void PassUtils::replace_block(ssa::Function *func, ssa::ControlFlowGraph &cfg, u
 }
 
 ssa::InstrIter PassUtils::find_def(ssa::Function &func, ssa::VirtualRegister reg) {
-    for (ssa::BasicBlock &block : func) {
-        for (ssa::InstrIter iter = block.begin(); iter != block.end(); ++iter) {
-            if (iter->get_dest() && iter->get_dest() == reg) {
-                return iter;
-            }
-        }
-    }
-
-    return nullptr;
+    return func.get_def_use_index().find_def(reg);
 }
 
 ssa::BasicBlockIter PassUtils::find_def_block(ssa::Function &func, ssa::VirtualRegister reg) {
+    // Block parameters are not part of the def-use index, so they are still looked up by scanning the blocks.
+    ssa::BasicBlock *def_block = func.get_def_use_index().find_def_block(reg);
+
     for (ssa::BasicBlockIter block = func.begin(); block != func.end(); ++block) {
-        for (ssa::VirtualRegister param_reg : block->get_param_regs()) {
-            if (param_reg == reg) {
+        if (def_block) {
+            if (&*block == def_block) {
                 return block;
             }
-        }
-
-        for (ssa::InstrIter instr = block->begin(); instr != block->end(); ++instr) {
-            if (instr->get_dest() && instr->get_dest() == reg) {
-                return block;
+        } else {
+            for (ssa::VirtualRegister param_reg : block->get_param_regs()) {
+                if (param_reg == reg) {
+                    return block;
+                }
             }
         }
     }
@@ -158,18 +185,6 @@ ssa::BasicBlockIter PassUtils::find_def_block(ssa::Function &func, ssa::VirtualR
     return nullptr;
 }
 
-PassUtils::UseMap PassUtils::collect_uses(ssa::Function &func) {
-    UseMap uses;
-
-    for (ssa::BasicBlock &block : func) {
-        for (ssa::InstrIter iter = block.begin(); iter != block.end(); ++iter) {
-            iter_regs(iter->get_operands(), [&uses, iter](ssa::VirtualRegister reg) { uses[reg].push_back(iter); });
-        }
-    }
-
-    return uses;
-}
-
 } // namespace passes
 
 } // namespace banjo
@@ -338,6 +338,11 @@ bool PeepholeOptimizer::types_compatible(ssa::Type a, ssa::Type b) {
         return false;
     }
 
+    // Values of different lengths only partially overlap, e.g. a lane loaded from a stored vector.
+    if (a.get_array_length() != b.get_array_length() || a.is_vector() != b.is_vector()) {
+        return false;
+    }
+
     if (a.get_primitive() == b.get_primitive()) {
         return true;
     }
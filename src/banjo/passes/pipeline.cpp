@@ -12,6 +12,7 @@
 #include "banjo/passes/legalizer.hpp"
 #include "banjo/passes/licm_pass.hpp"
 #include "banjo/passes/loop_inversion_pass.hpp"
+#include "banjo/passes/loop_vectorizer_pass.hpp"
 #include "banjo/passes/peephole_optimizer.hpp"
 #include "banjo/passes/sroa_pass.hpp"
 #include "banjo/passes/stack_slot_merge_pass.hpp"
@@ -70,6 +71,11 @@ std::vector<Pass *> Pipeline::create_opt_passes() {
     if (config.opt_level >= 2) {
         // passes.push_back(new CSEPass(target));
         passes.push_back(new LICMPass(target));
+
+        // The vectorizer emits packed SSE operations, which only the x86-64 backend can lower.
+        if (target->get_descr().get_architecture() == target::Architecture::X86_64) {
+            passes.push_back(new LoopVectorizerPass(target));
+        }
     }
 
     if (config.opt_level >= 1) {
@@ -101,6 +107,11 @@ void Pipeline::run_pass(Pass *pass, unsigned index, ssa::Module &mod) {
         pass->run(mod);
     }
 
+    // Passes are free to rewrite operands in place, so def-use indices don't survive from one pass to the next.
+    for (ssa::Function *func : mod.get_functions()) {
+        func->def_use_index.invalidate();
+    }
+
     if (config.debug) {
         std::ofstream stream{"dumps/" + name + ".bnjssa"};
         ssa::Writer(stream).write(mod);
@@ -25,7 +25,6 @@ void SROAPass::run(ssa::Module &mod) {
 void SROAPass::run(ssa::Function *func) {
     stack_values.clear();
     stack_ptr_defs.clear();
-    use_map = PassUtils::collect_uses(*func);
 
     for (ssa::BasicBlockIter iter = func->begin(); iter != func->end(); ++iter) {
         collect_stack_values(iter);
@@ -184,12 +183,12 @@ void SROAPass::collect_stack_ptr_defs(ssa::Function &func) {
             continue;
         }
 
-        collect_member_ptr_defs(use_map, reg, value);
+        collect_member_ptr_defs(func, reg, value);
     }
 }
 
-void SROAPass::collect_member_ptr_defs(PassUtils::UseMap &use_map, ssa::VirtualRegister base, StackValue &value) {
-    for (ssa::InstrIter use : use_map[base]) {
+void SROAPass::collect_member_ptr_defs(ssa::Function &func, ssa::VirtualRegister base, StackValue &value) {
+    for (ssa::InstrIter use : func.get_def_use_index().find_uses(base)) {
         if (use->get_opcode() != ssa::Opcode::MEMBERPTR) {
             continue;
         }
@@ -211,7 +210,7 @@ void SROAPass::collect_member_ptr_defs(PassUtils::UseMap &use_map, ssa::VirtualR
         stack_ptr_defs.insert({dst, member_value_index});
 
         if (member.members) {
-            collect_member_ptr_defs(use_map, dst, member);
+            collect_member_ptr_defs(func, dst, member);
         }
     }
 }
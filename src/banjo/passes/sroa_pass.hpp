@@ -7,6 +7,8 @@
 
 #include <functional>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace banjo::passes {
 
@@ -35,7 +37,6 @@ private:
 
     std::vector<StackValue> stack_values;
     std::unordered_map<ssa::VirtualRegister, unsigned> stack_ptr_defs;
-    PassUtils::UseMap use_map;
 
 public:
     SROAPass(target::Target *target);
@@ -50,7 +51,7 @@ private:
     void split_member(StackValue &value, ssa::Function *func);
 
     void collect_stack_ptr_defs(ssa::Function &func);
-    void collect_member_ptr_defs(PassUtils::UseMap &use_map, ssa::VirtualRegister base, StackValue &value);
+    void collect_member_ptr_defs(ssa::Function &func, ssa::VirtualRegister base, StackValue &value);
 
     void split_copies(ssa::Function *func, ssa::BasicBlock &block);
     void copy_members(InsertionContext &ctx, Ref dst, Ref src, const ssa::Type &type);
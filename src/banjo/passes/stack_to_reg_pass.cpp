@@ -97,6 +97,9 @@ void StackToRegPass::run(ssa::Function *func) {
 
     rename(func->begin(), slots, blocks, init_replacements, dt);
 
+    // Renaming rewrites operands in place, so the def-use index has to be rebuilt.
+    func->def_use_index.invalidate();
+
     Precomputing::precompute_instrs(*func);
     ssa::DeadCodeElimination().run(*func);
 }
@@ -331,12 +334,17 @@ void StackToRegPass::rename(
 }
 
 void StackToRegPass::replace_regs(
-    std::vector<ssa::Operand> &operands,
-    std::unordered_map<ssa::VirtualRegister, ssa::Value> cur_replacements
+    ssa::Instruction::OperandList &operands,
+    const std::unordered_map<ssa::VirtualRegister, ssa::Value> &cur_replacements
 ) {
     PassUtils::iter_values(operands, [&cur_replacements](ssa::Value &value) {
-        if (value.is_register() && cur_replacements.count(value.get_register())) {
-            value = cur_replacements[value.get_register()];
+        if (!value.is_register()) {
+            return;
+        }
+
+        auto iter = cur_replacements.find(value.get_register());
+        if (iter != cur_replacements.end()) {
+            value = iter->second;
         }
     });
 }
@@ -344,12 +352,13 @@ void StackToRegPass::replace_regs(
 void StackToRegPass::update_branch_target(
     ssa::Operand &operand,
     BlockMap &blocks,
-    std::unordered_map<ssa::VirtualRegister, ssa::Value> cur_replacements
+    const std::unordered_map<ssa::VirtualRegister, ssa::Value> &cur_replacements
 ) {
     ssa::BranchTarget &target = operand.get_branch_target();
 
     for (ParamInfo &param : blocks[target.block].new_params) {
-        target.args.push_back(cur_replacements[param.stack_slot]);
+        auto iter = cur_replacements.find(param.stack_slot);
+        target.args.push_back(iter == cur_replacements.end() ? ssa::Value{} : iter->second);
     }
 }
 
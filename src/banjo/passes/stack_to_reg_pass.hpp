@@ -64,14 +64,14 @@ private:
     );
 
     void replace_regs(
-        std::vector<ssa::Operand> &operands,
-        std::unordered_map<ssa::VirtualRegister, ssa::Value> cur_replacements
+        ssa::Instruction::OperandList &operands,
+        const std::unordered_map<ssa::VirtualRegister, ssa::Value> &cur_replacements
     );
 
     void update_branch_target(
         ssa::Operand &operand,
         BlockMap &blocks,
-        std::unordered_map<ssa::VirtualRegister, ssa::Value> cur_replacements
+        const std::unordered_map<ssa::VirtualRegister, ssa::Value> &cur_replacements
     );
 };
 
@@ -283,6 +283,9 @@ std::string ReportText::primitive_to_string(sir::Primitive primitive) {
         case sir::Primitive::USIZE: return "usize";
         case sir::Primitive::F32: return "f32";
         case sir::Primitive::F64: return "f64";
+        case sir::Primitive::F32X4: return "f32x4";
+        case sir::Primitive::F64X2: return "f64x2";
+        case sir::Primitive::I32X4: return "i32x4";
         case sir::Primitive::BOOL: return "bool";
         case sir::Primitive::ADDR: return "addr";
         case sir::Primitive::VOID: return "void";
@@ -503,7 +503,7 @@ Result ExprAnalyzer::analyze_closure_literal(sir::ClosureLiteral &closure_litera
     sir::Expr callee = analyzer.create(
         sir::SpecializeExpr{
             .ast_node = nullptr,
-            .type = sir::Specializer{analyzer.mod->trivial_arena, new_def_generic.generic_params, generic_args}
+            .type = sir::Specializer{analyzer.get_type_interner(), new_def_generic.generic_params, generic_args}
                         .specialize_func_type(new_def_generic.type),
             .symbol = &new_def_generic,
             .args = generic_args,
@@ -617,7 +617,7 @@ Result ExprAnalyzer::analyze_binary_expr(sir::BinaryExpr &binary_expr, sir::Expr
             RESULT_PROPAGATE(rhs_result)
 
             sir::Expr return_type = concrete_proto.def->func_decls[0].get_type().return_type;
-            sir::Specializer specializer{analyzer.mod->trivial_arena, concrete_proto};
+            sir::Specializer specializer{analyzer.get_type_interner(), concrete_proto};
             return_type = specializer.specialize_expr(return_type);
 
             out_expr = analyzer.create(
@@ -656,6 +656,11 @@ Result ExprAnalyzer::analyze_binary_expr(sir::BinaryExpr &binary_expr, sir::Expr
                 is_operator_built_in = op_type == BinaryOpType::ARITHMETIC || op_type == BinaryOpType::EQUALITY_COMP ||
                                        op_type == BinaryOpType::ORDER_COMP;
                 break;
+            case sir::Primitive::F32X4:
+            case sir::Primitive::F64X2:
+            case sir::Primitive::I32X4:
+                is_operator_built_in = is_vector_op(binary_expr.op, *primitive_type);
+                break;
             case sir::Primitive::BOOL:
                 is_operator_built_in = op_type == BinaryOpType::EQUALITY_COMP || op_type == BinaryOpType::LOGICAL;
                 break;
@@ -757,6 +762,15 @@ Result ExprAnalyzer::analyze_binary_expr(sir::BinaryExpr &binary_expr, sir::Expr
             return Result::ERROR;
         }
 
+        // Literals on the left-hand side are coerced to the vector type of the right-hand side, so the operator
+        // has to be checked again.
+        if (auto vector_type = lhs_type.match<sir::PrimitiveType>(); vector_type && vector_type->is_vector()) {
+            if (!is_vector_op(binary_expr.op, *vector_type)) {
+                analyzer.report_generator.report_err_cannot_apply_operator(binary_expr);
+                return Result::ERROR;
+            }
+        }
+
         binary_expr.type = lhs_type;
     } else if (binary_expr.is_comparison_op()) {
         binary_expr.type = sir::create_primitive_type(analyzer.get_mod(), sir::Primitive::BOOL);
@@ -1463,7 +1477,7 @@ std::optional<ExprAnalyzer::ResolvedGenericMethod> ExprAnalyzer::resolve_generic
     func_type = analyzer.create(*func_type);
 
     if (concrete_proto->is_specialization()) {
-        sir::Specializer specializer{analyzer.mod->trivial_arena, *concrete_proto};
+        sir::Specializer specializer{analyzer.get_type_interner(), *concrete_proto};
         func_type = specializer.specialize_func_type(*func_type);
     }
 
@@ -1970,6 +1984,9 @@ Result ExprAnalyzer::analyze_bracket_expr(sir::BracketExpr &bracket_expr, sir::E
         return analyze_index_expr(bracket_expr, pointer_type->base_type, out_expr);
     } else if (auto static_array_type = lhs_type.match<sir::StaticArrayType>()) {
         return analyze_index_expr(bracket_expr, static_array_type->base_type, out_expr);
+    } else if (auto vector_type = lhs_type.match<sir::PrimitiveType>(); vector_type && vector_type->is_vector()) {
+        sir::Expr element_type = sir::create_primitive_type(analyzer.get_mod(), vector_type->get_vector_element());
+        return analyze_index_expr(bracket_expr, element_type, out_expr);
     } else if (auto concrete_struct = lhs_type.match_concrete<sir::StructDef>()) {
         sir::StructDef &struct_def = *concrete_struct->def;
 
@@ -2171,7 +2188,7 @@ Result ExprAnalyzer::analyze_dot_expr_rhs(sir::DotExpr &dot_expr, sir::Expr &out
 
             if (auto specialize_expr = dot_expr.lhs.match<sir::SpecializeExpr>()) {
                 sir::Specializer specializer{
-                    analyzer.mod->trivial_arena,
+                    analyzer.get_type_interner(),
                     specialize_expr->symbol.get_generic_params(),
                     specialize_expr->args,
                 };
@@ -2253,7 +2270,7 @@ Result ExprAnalyzer::analyze_dot_expr_rhs(sir::DotExpr &dot_expr, sir::Expr &out
 
         if (!concrete_struct->generic_args.empty()) {
             sir::Specializer specializer{
-                analyzer.mod->trivial_arena,
+                analyzer.get_type_interner(),
                 struct_def->generic_params,
                 concrete_struct->generic_args,
             };
@@ -2455,7 +2472,7 @@ void ExprAnalyzer::resolve_type_aliases(sir::Expr &expr) {
         }
 
         if (type_alias->def->is_generic()) {
-            sir::Specializer specializer{analyzer.mod->trivial_arena, *type_alias};
+            sir::Specializer specializer{analyzer.get_type_interner(), *type_alias};
             expr = specializer.specialize_expr(type_alias->def->type);
         } else {
             expr = type_alias->def->type;
@@ -2465,7 +2482,7 @@ void ExprAnalyzer::resolve_type_aliases(sir::Expr &expr) {
 
 sir::Expr ExprAnalyzer::specialize(sir::Symbol symbol, std::span<sir::Expr> generic_args, ASTNode *ast_node) {
     std::span<sir::GenericParam *> generic_params = symbol.get_generic_params();
-    sir::Specializer specializer{analyzer.mod->trivial_arena, generic_params, generic_args};
+    sir::Specializer specializer{analyzer.get_type_interner(), generic_params, generic_args};
 
     sir::Expr type = nullptr;
 
@@ -2592,6 +2609,18 @@ ExprAnalyzer::BinaryOpType ExprAnalyzer::get_binary_op_type(sir::BinaryOp op) {
     }
 }
 
+bool ExprAnalyzer::is_vector_op(sir::BinaryOp op, const sir::PrimitiveType &vector_type) {
+    switch (op) {
+        case sir::BinaryOp::ADD:
+        case sir::BinaryOp::SUB:
+        case sir::BinaryOp::MUL:
+        case sir::BinaryOp::EQ:
+        case sir::BinaryOp::NE: return true;
+        case sir::BinaryOp::DIV: return vector_type.primitive != sir::Primitive::I32X4;
+        default: return false;
+    }
+}
+
 bool ExprAnalyzer::can_be_coerced(sir::Expr value) {
     if (auto dot_expr = value.match<sir::DotExpr>()) {
         return !dot_expr->lhs;
@@ -125,6 +125,7 @@ private:
     sir::ProtoDef *proto_of(sir::BinaryOp op);
     sir::ProtoDef *proto_of(sir::UnaryOp op);
     BinaryOpType get_binary_op_type(sir::BinaryOp op);
+    bool is_vector_op(sir::BinaryOp op, const sir::PrimitiveType &vector_type);
     bool can_be_coerced(sir::Expr value);
     bool is_non_generic(sir::Expr type);
     bool is_method(sir::Symbol symbol);
@@ -281,7 +281,8 @@ Result ExprFinalizer::coerce_to_std_result(sir::Expr &inout_expr, sir::Concrete<
 }
 
 Result ExprFinalizer::finalize_coercion(sir::IntLiteral &int_literal, sir::Expr type) {
-    if (!(type.is_int_type() || type.is_addr_like_type())) {
+    // Integer literals coerced to an integer vector type are splatted into every lane.
+    if (!(type.is_int_type() || type.is_addr_like_type() || type.is_primitive_type(sir::Primitive::I32X4))) {
         analyzer.report_generator.report_err_cannot_coerce(int_literal, type);
         return Result::ERROR;
     }
@@ -293,7 +294,9 @@ Result ExprFinalizer::finalize_coercion(sir::IntLiteral &int_literal, sir::Expr
 }
 
 Result ExprFinalizer::finalize_coercion(sir::FPLiteral &fp_literal, sir::Expr type) {
-    if (!type.is_fp_type()) {
+    // Floating-point literals coerced to a floating-point vector type are splatted into every lane.
+    if (!(type.is_fp_type() || type.is_primitive_type(sir::Primitive::F32X4) ||
+          type.is_primitive_type(sir::Primitive::F64X2))) {
         analyzer.report_generator.report_err_cannot_coerce(fp_literal, type);
         return Result::ERROR;
     }
@@ -350,6 +353,20 @@ Result ExprFinalizer::finalize_coercion(sir::ArrayLiteral &array_literal, sir::E
             return Result::ERROR;
         }
 
+        return Result::SUCCESS;
+    } else if (auto vector_type = type.match<sir::PrimitiveType>(); vector_type && vector_type->is_vector()) {
+        sir::Expr element_type = sir::create_primitive_type(analyzer.get_mod(), vector_type->get_vector_element());
+
+        array_literal.type = type;
+        finalize_array_literal_elements(array_literal, element_type);
+
+        unsigned expected_length = vector_type->get_vector_length();
+
+        if (array_literal.values.size() != expected_length) {
+            analyzer.report_generator.report_err_unexpected_array_length(array_literal, expected_length);
+            return Result::ERROR;
+        }
+
         return Result::SUCCESS;
     } else {
         analyzer.report_generator.report_err_cannot_coerce(array_literal, type);
@@ -984,7 +1001,7 @@ Result ExprFinalizer::finalize_struct_literal_fields(sir::StructLiteral &struct_
             sir::Expr field_type = entry.field->type;
 
             if (!concrete_struct->generic_args.empty()) {
-                sir::Specializer specializer{analyzer.mod->trivial_arena, *concrete_struct};
+                sir::Specializer specializer{analyzer.get_type_interner(), *concrete_struct};
                 field_type = specializer.specialize_expr(field_type);
             }
 
@@ -1059,6 +1076,7 @@ void ExprFinalizer::check_int_literal_range(sir::IntLiteral &int_literal) {
                 range = {std::numeric_limits<std::int16_t>::min(), std::numeric_limits<std::int16_t>::max()};
                 break;
             case sir::Primitive::I32:
+            case sir::Primitive::I32X4:
                 range = {std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max()};
                 break;
             case sir::Primitive::I64:
@@ -1077,6 +1095,8 @@ void ExprFinalizer::check_int_literal_range(sir::IntLiteral &int_literal) {
             case sir::Primitive::USIZE: return; // TODO
             case sir::Primitive::F32: ASSERT_UNREACHABLE;
             case sir::Primitive::F64: ASSERT_UNREACHABLE;
+            case sir::Primitive::F32X4: ASSERT_UNREACHABLE;
+            case sir::Primitive::F64X2: ASSERT_UNREACHABLE;
             case sir::Primitive::BOOL: ASSERT_UNREACHABLE;
             case sir::Primitive::ADDR: return; // TODO
             case sir::Primitive::VOID: ASSERT_UNREACHABLE;
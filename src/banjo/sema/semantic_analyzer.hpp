@@ -160,6 +160,7 @@ public:
 
 private:
     sir::Module &get_mod() { return *mod; }
+    sir::TypeInterner &get_type_interner() { return sir_unit.type_interner; }
     sir::DeclBlock &get_decl_block() { return *scope_stack.top().decl_block; }
 
     sir::SymbolTable &get_symbol_table() { return *scope_stack.top().symbol_table; }
@@ -194,7 +195,7 @@ private:
             return expr;
         }
 
-        return sir::Specializer{mod->trivial_arena, specialization}.specialize_expr(expr);
+        return sir::Specializer{sir_unit.type_interner, specialization}.specialize_expr(expr);
     }
 
     void add_symbol_def(sir::Symbol sir_symbol);
@@ -690,7 +690,7 @@ void StmtAnalyzer::analyze_for_iter_stmt(sir::ForStmt &for_stmt, sir::Stmt &out_
     sir::FuncType *iter_func_type = &iter_func_def.type;
 
     if (iterable_struct_def->is_specialization()) {
-        sir::Specializer specializer{analyzer.mod->trivial_arena, *iterable_struct_def};
+        sir::Specializer specializer{analyzer.get_type_interner(), *iterable_struct_def};
         iter_func_type = specializer.specialize_func_type(*iter_func_type);
     }
 
@@ -708,7 +708,7 @@ void StmtAnalyzer::analyze_for_iter_stmt(sir::ForStmt &for_stmt, sir::Stmt &out_
     sir::FuncType *next_func_type = &next_func_def.type;
 
     if (iter_struct_def->is_specialization()) {
-        sir::Specializer specializer{analyzer.mod->trivial_arena, *iter_struct_def};
+        sir::Specializer specializer{analyzer.get_type_interner(), *iter_struct_def};
         next_func_type = specializer.specialize_func_type(*next_func_type);
     }
 
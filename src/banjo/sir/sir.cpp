@@ -185,6 +185,14 @@ bool Expr::is_number_type() const {
     return is_int_type() || is_fp_type();
 }
 
+bool Expr::is_vector_type() const {
+    if (auto primitive_type = match<PrimitiveType>()) {
+        return primitive_type->is_vector();
+    } else {
+        return false;
+    }
+}
+
 bool Expr::is_addr_like_type() const {
     return is_primitive_type(Primitive::ADDR) || is<PointerType>() || is<FuncType>();
 }
@@ -559,6 +567,28 @@ bool BinaryExpr::is_logical_op() {
     }
 }
 
+bool PrimitiveType::is_vector() const {
+    return primitive == Primitive::F32X4 || primitive == Primitive::F64X2 || primitive == Primitive::I32X4;
+}
+
+Primitive PrimitiveType::get_vector_element() const {
+    switch (primitive) {
+        case Primitive::F32X4: return Primitive::F32;
+        case Primitive::F64X2: return Primitive::F64;
+        case Primitive::I32X4: return Primitive::I32;
+        default: ASSERT_UNREACHABLE;
+    }
+}
+
+unsigned PrimitiveType::get_vector_length() const {
+    switch (primitive) {
+        case Primitive::F32X4: return 4;
+        case Primitive::F64X2: return 2;
+        case Primitive::I32X4: return 4;
+        default: ASSERT_UNREACHABLE;
+    }
+}
+
 bool PseudoType::is_number() {
     switch (kind) {
         case PseudoTypeKind::INT_LITERAL:
@@ -766,6 +796,194 @@ Resource *Module::create(Resource value) {
     return resource_arena.create(std::move(value));
 }
 
+static void combine_hash(std::size_t &hash, std::size_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15 + (hash << 6) + (hash >> 2);
+}
+
+Expr TypeInterner::intern(Expr expr) {
+    if (!is_internable(expr) || hashes.contains(get_pointer(expr))) {
+        return expr;
+    }
+
+    if (auto symbol_expr = expr.match<SymbolExpr>()) {
+        return insert(*symbol_expr);
+    } else if (auto primitive_type = expr.match<PrimitiveType>()) {
+        return insert(*primitive_type);
+    } else if (auto pointer_type = expr.match<PointerType>()) {
+        return insert(
+            PointerType{
+                .ast_node = pointer_type->ast_node,
+                .base_type = intern(pointer_type->base_type),
+            }
+        );
+    } else if (auto static_array_type = expr.match<StaticArrayType>()) {
+        return insert(
+            StaticArrayType{
+                .ast_node = static_array_type->ast_node,
+                .base_type = intern(static_array_type->base_type),
+                .length = static_array_type->length,
+            }
+        );
+    } else if (auto reference_type = expr.match<ReferenceType>()) {
+        return insert(
+            ReferenceType{
+                .ast_node = reference_type->ast_node,
+                .mut = reference_type->mut,
+                .base_type = intern(reference_type->base_type),
+            }
+        );
+    } else if (auto tuple_expr = expr.match<TupleExpr>()) {
+        return insert(
+            TupleExpr{
+                .ast_node = tuple_expr->ast_node,
+                .type = tuple_expr->type,
+                .exprs = intern_list(tuple_expr->exprs),
+            }
+        );
+    } else if (auto specialize_expr = expr.match<SpecializeExpr>()) {
+        return insert(
+            SpecializeExpr{
+                .ast_node = specialize_expr->ast_node,
+                .type = specialize_expr->type,
+                .symbol = specialize_expr->symbol,
+                .args = intern_list(specialize_expr->args),
+            }
+        );
+    } else {
+        ASSERT_UNREACHABLE;
+    }
+}
+
+std::span<Expr> TypeInterner::intern_list(std::span<Expr> exprs) {
+    if (exprs.empty()) {
+        return {};
+    }
+
+    auto iter = list_lengths.find(exprs.data());
+
+    if (iter != list_lengths.end() && iter->second == exprs.size()) {
+        return exprs;
+    }
+
+    std::vector<Expr> canonical_exprs(exprs.size());
+    std::size_t list_hash = exprs.size();
+
+    for (unsigned i = 0; i < exprs.size(); i++) {
+        canonical_exprs[i] = intern(exprs[i]);
+        combine_hash(list_hash, hash(canonical_exprs[i]));
+    }
+
+    std::vector<std::span<Expr>> &bucket = list_buckets[list_hash];
+
+    for (std::span<Expr> candidate : bucket) {
+        if (utils::equal(candidate, canonical_exprs)) {
+            return candidate;
+        }
+    }
+
+    std::span<Expr> list = arena.create_array<Expr>(canonical_exprs);
+    bucket.push_back(list);
+    list_lengths.insert({list.data(), list.size()});
+    return list;
+}
+
+std::size_t TypeInterner::hash(Expr expr) const {
+    auto iter = hashes.find(get_pointer(expr));
+
+    if (iter != hashes.end()) {
+        return iter->second;
+    } else {
+        return hash_node(expr, [this](Expr child) { return hash(child); });
+    }
+}
+
+bool TypeInterner::is_internable(Expr expr) {
+    bool internable_kind = expr.is<SymbolExpr>() || expr.is<PrimitiveType>() || expr.is<PointerType>() ||
+                           expr.is<StaticArrayType>() || expr.is<ReferenceType>() || expr.is<TupleExpr>() ||
+                           expr.is<SpecializeExpr>();
+
+    return internable_kind && expr.is_type();
+}
+
+std::size_t TypeInterner::compute_hash(Expr expr) {
+    return hash_node(expr, [](Expr child) { return compute_hash(child); });
+}
+
+std::size_t TypeInterner::compute_list_hash(std::span<const Expr> exprs) {
+    std::size_t list_hash = exprs.size();
+
+    for (Expr expr : exprs) {
+        combine_hash(list_hash, compute_hash(expr));
+    }
+
+    return list_hash;
+}
+
+template <typename T>
+Expr TypeInterner::insert(T value) {
+    Expr candidate = &value;
+    std::size_t node_hash = hash_node(candidate, [this](Expr child) { return hash(child); });
+    std::vector<Expr> &bucket = type_buckets[node_hash];
+
+    for (Expr canonical : bucket) {
+        if (canonical == candidate) {
+            return canonical;
+        }
+    }
+
+    Expr canonical = arena.create<T>(value);
+    bucket.push_back(canonical);
+    hashes.insert({get_pointer(canonical), node_hash});
+    return canonical;
+}
+
+// Types that are equal according to `Comparison` must have the same hash, so this only hashes the parts of a node
+// that the comparison looks at.
+template <typename ChildHashFunc>
+std::size_t TypeInterner::hash_node(Expr expr, ChildHashFunc child_hash) {
+    std::size_t node_hash = expr.kind.index();
+
+    if (auto int_literal = expr.match<IntLiteral>()) {
+        combine_hash(node_hash, int_literal->value.to_bits());
+    } else if (auto symbol_expr = expr.match<SymbolExpr>()) {
+        combine_hash(node_hash, symbol_expr->symbol.compute_hash());
+    } else if (auto tuple_expr = expr.match<TupleExpr>()) {
+        for (Expr element : tuple_expr->exprs) {
+            combine_hash(node_hash, child_hash(element));
+        }
+    } else if (auto specialize_expr = expr.match<SpecializeExpr>()) {
+        combine_hash(node_hash, specialize_expr->symbol.compute_hash());
+
+        for (Expr arg : specialize_expr->args) {
+            combine_hash(node_hash, child_hash(arg));
+        }
+    } else if (auto primitive_type = expr.match<PrimitiveType>()) {
+        combine_hash(node_hash, static_cast<std::size_t>(primitive_type->primitive));
+    } else if (auto pointer_type = expr.match<PointerType>()) {
+        combine_hash(node_hash, child_hash(pointer_type->base_type));
+    } else if (auto static_array_type = expr.match<StaticArrayType>()) {
+        combine_hash(node_hash, child_hash(static_array_type->base_type));
+        combine_hash(node_hash, child_hash(static_array_type->length));
+    } else if (auto func_type = expr.match<FuncType>()) {
+        for (const Param &param : func_type->params) {
+            combine_hash(node_hash, child_hash(param.type));
+        }
+
+        combine_hash(node_hash, child_hash(func_type->return_type));
+    } else if (auto closure_type = expr.match<ClosureType>()) {
+        combine_hash(node_hash, child_hash(&closure_type->func_type));
+    } else if (auto reference_type = expr.match<ReferenceType>()) {
+        combine_hash(node_hash, reference_type->mut);
+        combine_hash(node_hash, child_hash(reference_type->base_type));
+    }
+
+    return node_hash;
+}
+
+const void *TypeInterner::get_pointer(Expr expr) {
+    return std::visit([](auto pointer) -> const void * { return pointer; }, expr.kind);
+}
+
 std::strong_ordering operator<=>(const SemaStage &lhs, const SemaStage &rhs) {
     return static_cast<unsigned>(lhs) <=> static_cast<unsigned>(rhs);
 }
@@ -162,6 +162,7 @@ struct Concrete {
 
 class Expr {
     friend class Comparison;
+    friend class TypeInterner;
 
     std::variant<
         IntLiteral *,       // 0
@@ -290,6 +291,7 @@ public:
     bool is_unsigned_type() const;
     bool is_fp_type() const;
     bool is_number_type() const;
+    bool is_vector_type() const;
     bool is_addr_like_type() const;
     std::optional<Concrete<ProtoDef>> match_proto_ptr() const;
     bool is_u8_ptr() const;
@@ -857,6 +859,9 @@ enum class Primitive {
     USIZE,
     F32,
     F64,
+    F32X4,
+    F64X2,
+    I32X4,
     BOOL,
     ADDR,
     VOID,
@@ -865,6 +870,10 @@ enum class Primitive {
 struct PrimitiveType {
     ASTNode *ast_node;
     Primitive primitive;
+
+    bool is_vector() const;
+    Primitive get_vector_element() const;
+    unsigned get_vector_length() const;
 };
 
 struct PointerType {
@@ -1485,10 +1494,44 @@ Attributes *Module::create(Attributes value);
 template <>
 Resource *Module::create(Resource value);
 
+// Hash-consing table for types. Interned types and generic argument lists that are structurally identical share a
+// single canonical node with a precomputed hash, so comparing two of them is a pointer comparison. Canonical nodes
+// are never mutated and live as long as the interner.
+class TypeInterner {
+
+private:
+    utils::Arena arena{4096};
+    std::unordered_map<std::size_t, std::vector<Expr>> type_buckets;
+    std::unordered_map<std::size_t, std::vector<std::span<Expr>>> list_buckets;
+    std::unordered_map<const void *, std::size_t> hashes;
+    std::unordered_map<const Expr *, std::size_t> list_lengths;
+
+public:
+    utils::Arena &get_arena() { return arena; }
+
+    Expr intern(Expr expr);
+    std::span<Expr> intern_list(std::span<Expr> exprs);
+    std::size_t hash(Expr expr) const;
+
+    static bool is_internable(Expr expr);
+    static std::size_t compute_hash(Expr expr);
+    static std::size_t compute_list_hash(std::span<const Expr> exprs);
+
+private:
+    template <typename T>
+    Expr insert(T value);
+
+    template <typename ChildHashFunc>
+    static std::size_t hash_node(Expr expr, ChildHashFunc child_hash);
+
+    static const void *get_pointer(Expr expr);
+};
+
 struct Unit {
     utils::TypedArena<Module> mod_arena;
     std::vector<Module *> mods;
     std::unordered_map<ModulePath, Module *> mods_by_path;
+    TypeInterner type_interner;
 
     Module *create_mod() { return mod_arena.create(); }
 };
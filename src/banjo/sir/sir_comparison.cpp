@@ -20,6 +20,11 @@ bool Comparison::compare(Expr lhs, Expr rhs) {
         return false;
     }
 
+    // Interned types share their nodes, so two references to the same type node are equal.
+    if (lhs.kind == rhs.kind && TypeInterner::is_internable(lhs)) {
+        return true;
+    }
+
     SIR_VISIT_EXPR(
         lhs,
         return true,                                       // empty
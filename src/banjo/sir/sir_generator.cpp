@@ -920,6 +920,9 @@ sir::Expr SIRGenerator::generate_expr(ASTNode *node) {
         case AST_U64: return generate_primitive_type(node, sir::Primitive::U64);
         case AST_F32: return generate_primitive_type(node, sir::Primitive::F32);
         case AST_F64: return generate_primitive_type(node, sir::Primitive::F64);
+        case AST_F32X4: return generate_primitive_type(node, sir::Primitive::F32X4);
+        case AST_F64X2: return generate_primitive_type(node, sir::Primitive::F64X2);
+        case AST_I32X4: return generate_primitive_type(node, sir::Primitive::I32X4);
         case AST_USIZE: return generate_primitive_type(node, sir::Primitive::USIZE);
         case AST_BOOL: return generate_primitive_type(node, sir::Primitive::BOOL);
         case AST_ADDR: return generate_primitive_type(node, sir::Primitive::ADDR);
@@ -902,6 +902,9 @@ void Printer::print_primitive_type(const PrimitiveType &primitive_type) {
         case Primitive::USIZE: PRINT_FIELD("primitive", "USIZE"); break;
         case Primitive::F32: PRINT_FIELD("primitive", "F32"); break;
         case Primitive::F64: PRINT_FIELD("primitive", "F64"); break;
+        case Primitive::F32X4: PRINT_FIELD("primitive", "F32X4"); break;
+        case Primitive::F64X2: PRINT_FIELD("primitive", "F64X2"); break;
+        case Primitive::I32X4: PRINT_FIELD("primitive", "I32X4"); break;
         case Primitive::BOOL: PRINT_FIELD("primitive", "BOOL"); break;
         case Primitive::ADDR: PRINT_FIELD("primitive", "ADDR"); break;
         case Primitive::VOID: PRINT_FIELD("primitive", "VOID"); break;
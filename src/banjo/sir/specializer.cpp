@@ -4,6 +4,7 @@
 #include "banjo/utils/macros.hpp"
 
 #include <span>
+#include <vector>
 
 namespace banjo::sir {
 
@@ -14,6 +15,18 @@ Specializer::Specializer(utils::Arena &arena, std::span<sir::GenericParam *> par
     ASSERT(params.size() == args.size());
 }
 
+Specializer::Specializer(
+    sir::TypeInterner &interner,
+    std::span<sir::GenericParam *> params,
+    std::span<sir::Expr> args
+)
+  : arena{interner.get_arena()},
+    interner{&interner},
+    params{params},
+    args{args} {
+    ASSERT(params.size() == args.size());
+}
+
 sir::Expr Specializer::specialize_expr(sir::Expr expr) {
     if (auto symbol_expr = expr.match<sir::SymbolExpr>()) {
         return specialize_symbol_expr(*symbol_expr);
@@ -32,11 +45,21 @@ sir::Expr Specializer::specialize_expr(sir::Expr expr) {
     } else if (auto reference_type = expr.match<sir::ReferenceType>()) {
         return specialize_reference_type(*reference_type);
     } else {
-        return expr;
+        return interner ? interner->intern(expr) : expr;
     }
 }
 
 std::span<sir::Expr> Specializer::specialize_expr_list(std::span<sir::Expr> exprs) {
+    if (interner) {
+        std::vector<sir::Expr> specialized_exprs(exprs.size());
+
+        for (unsigned i = 0; i < exprs.size(); i++) {
+            specialized_exprs[i] = specialize_expr(exprs[i]);
+        }
+
+        return interner->intern_list(specialized_exprs);
+    }
+
     std::span<sir::Expr> clone = arena.allocate_array<sir::Expr>(exprs.size());
 
     for (unsigned i = 0; i < clone.size(); i++) {
@@ -71,17 +94,32 @@ sir::Expr Specializer::specialize_symbol_expr(sir::SymbolExpr &symbol_expr) {
     if (auto generic_param = symbol_expr.symbol.match<sir::GenericParam>()) {
         for (unsigned i = 0; i < params.size(); i++) {
             if (params[i] == generic_param) {
-                return args[i];
+                return interner ? interner->intern(args[i]) : args[i];
             }
         }
 
         ASSERT_UNREACHABLE;
     } else {
-        return &symbol_expr;
+        return interner ? interner->intern(&symbol_expr) : &symbol_expr;
     }
 }
 
 sir::Expr Specializer::specialize_tuple_expr(sir::TupleExpr &tuple_expr) {
+    if (interner && sir::Expr{&tuple_expr}.is_type()) {
+        return create(
+            sir::TupleExpr{
+                .ast_node = tuple_expr.ast_node,
+                .type = specialize_expr(tuple_expr.type),
+                .exprs = specialize_expr_list(tuple_expr.exprs),
+            }
+        );
+    }
+
+    // Tuple values and their types may be modified later on, so they are never interned.
+    if (interner) {
+        return Specializer{arena, params, args}.specialize_tuple_expr(tuple_expr);
+    }
+
     std::span<sir::Expr> exprs = arena.allocate_array<sir::Expr>(tuple_expr.exprs.size());
 
     for (unsigned i = 0; i < tuple_expr.exprs.size(); i++) {
@@ -96,6 +134,17 @@ sir::Expr Specializer::specialize_tuple_expr(sir::TupleExpr &tuple_expr) {
 }
 
 sir::Expr Specializer::specialize_specialize_expr(sir::SpecializeExpr &specialize_expr) {
+    if (interner) {
+        return create(
+            sir::SpecializeExpr{
+                .ast_node = specialize_expr.ast_node,
+                .type = this->specialize_expr(specialize_expr.type),
+                .symbol = specialize_expr.symbol,
+                .args = specialize_expr_list(specialize_expr.args),
+            }
+        );
+    }
+
     std::span<sir::Expr> args = arena.allocate_array<sir::Expr>(specialize_expr.args.size());
 
     for (unsigned i = 0; i < specialize_expr.args.size(); i++) {
@@ -113,13 +162,15 @@ sir::Expr Specializer::specialize_specialize_expr(sir::SpecializeExpr &specializ
 sir::Expr Specializer::specialize_pointer_type(sir::PointerType &pointer_type) {
     sir::Expr base_type = specialize_expr(pointer_type.base_type);
 
-    if (base_type == pointer_type.base_type) {
+    if (!interner && base_type == pointer_type.base_type) {
         return &pointer_type;
     } else {
-        return arena.create<sir::PointerType>({
-            .ast_node = pointer_type.ast_node,
-            .base_type = base_type,
-        });
+        return create(
+            sir::PointerType{
+                .ast_node = pointer_type.ast_node,
+                .base_type = base_type,
+            }
+        );
     }
 }
 
@@ -128,14 +179,16 @@ sir::Expr Specializer::specialize_static_array_type(sir::StaticArrayType &static
 
     sir::Expr base_type = specialize_expr(static_array_type.base_type);
 
-    if (base_type == static_array_type.base_type) {
+    if (!interner && base_type == static_array_type.base_type) {
         return &static_array_type;
     } else {
-        return arena.create<sir::StaticArrayType>({
-            .ast_node = nullptr,
-            .base_type = base_type,
-            .length = static_array_type.length,
-        });
+        return create(
+            sir::StaticArrayType{
+                .ast_node = nullptr,
+                .base_type = base_type,
+                .length = static_array_type.length,
+            }
+        );
     }
 }
 
@@ -154,14 +207,16 @@ sir::Expr Specializer::specialize_closure_type(sir::ClosureType &closure_type) {
 sir::Expr Specializer::specialize_reference_type(sir::ReferenceType &reference_type) {
     sir::Expr base_type = specialize_expr(reference_type.base_type);
 
-    if (base_type == reference_type.base_type) {
+    if (!interner && base_type == reference_type.base_type) {
         return &reference_type;
     } else {
-        return arena.create<sir::ReferenceType>(sir::ReferenceType{
-            .ast_node = reference_type.ast_node,
-            .mut = reference_type.mut,
-            .base_type = base_type,
-        });
+        return create(
+            sir::ReferenceType{
+                .ast_node = reference_type.ast_node,
+                .mut = reference_type.mut,
+                .base_type = base_type,
+            }
+        );
     }
 }
 
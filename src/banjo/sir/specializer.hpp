@@ -12,16 +12,24 @@ class Specializer {
 
 private:
     utils::Arena &arena;
+    sir::TypeInterner *interner = nullptr;
     std::span<sir::GenericParam *> params;
     std::span<sir::Expr> args;
 
 public:
     Specializer(utils::Arena &arena, std::span<sir::GenericParam *> params, std::span<sir::Expr> args);
 
+    // Specialized types are interned and allocated in the arena of the interner.
+    Specializer(sir::TypeInterner &interner, std::span<sir::GenericParam *> params, std::span<sir::Expr> args);
+
     template <typename T>
     Specializer(utils::Arena &arena, sir::Concrete<T> specialization)
       : Specializer{arena, specialization.def->generic_params, specialization.generic_args} {}
 
+    template <typename T>
+    Specializer(sir::TypeInterner &interner, sir::Concrete<T> specialization)
+      : Specializer{interner, specialization.def->generic_params, specialization.generic_args} {}
+
     sir::Expr specialize_expr(sir::Expr expr);
     std::span<sir::Expr> specialize_expr_list(std::span<sir::Expr> exprs);
     sir::FuncType specialize_func_type_directly(sir::FuncType &func_type);
@@ -34,6 +42,16 @@ public:
     sir::FuncType *specialize_func_type(sir::FuncType &func_type);
     sir::Expr specialize_closure_type(sir::ClosureType &closure_type);
     sir::Expr specialize_reference_type(sir::ReferenceType &reference_type);
+
+private:
+    template <typename T>
+    sir::Expr create(T value) {
+        if (interner && sir::TypeInterner::is_internable(&value)) {
+            return interner->intern(&value);
+        } else {
+            return arena.create<T>(value);
+        }
+    }
 };
 
 } // namespace banjo::sir
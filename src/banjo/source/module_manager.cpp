@@ -10,6 +10,7 @@
 #include "banjo/source/module_path.hpp"
 #include "banjo/source/source_file.hpp"
 #include "banjo/utils/paths.hpp"
+#include "banjo/utils/timing.hpp"
 
 #include <filesystem>
 #include <fstream>
@@ -46,11 +47,78 @@ void ModuleManager::add_config_search_paths(const Config &config) {
 void ModuleManager::load_all() {
     std::vector<ModuleTreeNode> root_nodes = module_discovery.find_all_modules();
 
+    if (task_scheduler && task_scheduler->get_num_threads() > 1) {
+        load_all_parallel(root_nodes);
+        return;
+    }
+
     for (const ModuleTreeNode &root_node : root_nodes) {
         load_tree(root_node);
     }
 }
 
+void ModuleManager::load_all_parallel(const std::vector<ModuleTreeNode> &root_nodes) {
+    PROFILE_SCOPE("parallel module loading");
+
+    // The files are collected in the order in which `load_tree` would visit them so the module list
+    // and the reports end up in the same order as in a sequential load.
+    std::vector<PendingFile> files;
+
+    for (const ModuleTreeNode &root_node : root_nodes) {
+        collect_pending_files(root_node, -1, files);
+    }
+
+    task_scheduler->parallel_for(0, files.size(), [this, &files](std::size_t i) {
+        files[i].file = parse_module(files[i].node->file, files[i].report_manager);
+    });
+
+    std::vector<SourceFile *> loaded_files(files.size(), nullptr);
+
+    for (unsigned i = 0; i < files.size(); i++) {
+        PendingFile &file = files[i];
+
+        // Sub-modules of files that failed to load are skipped, just like in `load_tree`.
+        if (file.parent_index != -1 && !loaded_files[file.parent_index]) {
+            continue;
+        }
+
+        for (const Report &report : file.report_manager.get_reports()) {
+            report_manager.insert(report);
+        }
+
+        if (!file.file || !file.file->ast_mod) {
+            continue;
+        }
+
+        loaded_files[i] = module_list.add(std::move(file.file));
+
+        if (file.parent_index != -1) {
+            loaded_files[file.parent_index]->sub_mod_paths.push_back(loaded_files[i]->mod_path);
+        }
+    }
+}
+
+void ModuleManager::collect_pending_files(
+    const ModuleTreeNode &node,
+    int parent_index,
+    std::vector<PendingFile> &files
+) {
+    int index = static_cast<int>(files.size());
+
+    files.push_back(
+        PendingFile{
+            .node = &node,
+            .parent_index = parent_index,
+            .file = nullptr,
+            .report_manager = {},
+        }
+    );
+
+    for (const ModuleTreeNode &child : node.children) {
+        collect_pending_files(child, index, files);
+    }
+}
+
 SourceFile *ModuleManager::load_tree(const ModuleTreeNode &module_tree_node) {
     SourceFile *parsed_file = load(module_tree_node.file);
     if (!parsed_file) {
@@ -59,14 +127,17 @@ SourceFile *ModuleManager::load_tree(const ModuleTreeNode &module_tree_node) {
 
     for (const ModuleTreeNode &child : module_tree_node.children) {
         SourceFile *sub_mod = load_tree(child);
-        parsed_file->sub_mod_paths.push_back(sub_mod->mod_path);
+
+        if (sub_mod) {
+            parsed_file->sub_mod_paths.push_back(sub_mod->mod_path);
+        }
     }
 
     return parsed_file;
 }
 
 SourceFile *ModuleManager::load(const ModuleFile &location) {
-    std::unique_ptr<SourceFile> parsed_file = parse_module(location);
+    std::unique_ptr<SourceFile> parsed_file = parse_module(location, report_manager);
     if (!parsed_file || !parsed_file->ast_mod) {
         return nullptr;
     }
@@ -115,7 +186,7 @@ std::vector<ModulePath> ModuleManager::enumerate_root_paths() {
     return paths;
 }
 
-std::unique_ptr<SourceFile> ModuleManager::parse_module(const ModuleFile &module_file) {
+std::unique_ptr<SourceFile> ModuleManager::parse_module(const ModuleFile &module_file, ReportManager &file_reports) {
     if (module_file.path == ModulePath{"std", "config"}) {
         std::unique_ptr<SourceFile> file = std::make_unique<SourceFile>(SourceFile{
             .mod_path = module_file.path,
@@ -137,7 +208,7 @@ std::unique_ptr<SourceFile> ModuleManager::parse_module(const ModuleFile &module
 
     std::unique_ptr<SourceFile> file = SourceFile::read(module_file.path, module_file.file_path, stream);
     file->tokens = Lexer{*file, lexer_mode}.tokenize();
-    file->ast_mod = Parser{*file, file->tokens, report_manager}.parse_module();
+    file->ast_mod = Parser{*file, file->tokens, file_reports}.parse_module();
     return file;
 }
 
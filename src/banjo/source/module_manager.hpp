@@ -5,9 +5,11 @@
 #include "banjo/ast/module_list.hpp"
 #include "banjo/config/config.hpp"
 #include "banjo/lexer/lexer.hpp"
+#include "banjo/reports/report_manager.hpp"
 #include "banjo/source/module_discovery.hpp"
 #include "banjo/source/module_path.hpp"
 #include "banjo/source/source_file.hpp"
+#include "banjo/utils/task_scheduler.hpp"
 #include "banjo/source/text_range.hpp"
 
 #include <filesystem>
@@ -18,13 +20,13 @@
 namespace banjo {
 
 class ModuleLoader;
-class ReportManager;
 
 class ModuleManager {
 
 private:
     ReportManager &report_manager;
     Lexer::Mode lexer_mode;
+    utils::TaskScheduler *task_scheduler = nullptr;
 
     ModuleList module_list;
     ModuleDiscovery module_discovery;
@@ -37,6 +39,7 @@ public:
     void add_search_path(std::filesystem::path path);
     void add_standard_stdlib_search_path();
     void add_config_search_paths(const Config &config);
+    void set_task_scheduler(utils::TaskScheduler *task_scheduler) { this->task_scheduler = task_scheduler; }
 
     void load_all();
     SourceFile *load_tree(const ModuleTreeNode &module_tree_node);
@@ -49,7 +52,16 @@ public:
     std::vector<ModulePath> enumerate_root_paths();
 
 private:
-    std::unique_ptr<SourceFile> parse_module(const ModuleFile &module_file);
+    struct PendingFile {
+        const ModuleTreeNode *node;
+        int parent_index;
+        std::unique_ptr<SourceFile> file;
+        ReportManager report_manager;
+    };
+
+    void load_all_parallel(const std::vector<ModuleTreeNode> &root_nodes);
+    void collect_pending_files(const ModuleTreeNode &node, int parent_index, std::vector<PendingFile> &files);
+    std::unique_ptr<SourceFile> parse_module(const ModuleFile &module_file, ReportManager &file_reports);
 };
 
 } // namespace banjo
@@ -1,5 +1,7 @@
 #include "basic_block.hpp"
 
+#include "banjo/ssa/def_use_index.hpp"
+
 #include <utility>
 
 namespace banjo {
@@ -10,34 +12,123 @@ BasicBlock::BasicBlock(std::string label) : label(std::move(label)) {}
 
 BasicBlock::BasicBlock() {}
 
+// Copies are detached from the def-use index of the original block's function.
+BasicBlock::BasicBlock(const BasicBlock &other)
+  : instrs(other.instrs),
+    param_regs(other.param_regs),
+    param_types(other.param_types),
+    label(other.label) {}
+
+BasicBlock::BasicBlock(BasicBlock &&other) noexcept
+  : instrs(std::move(other.instrs)),
+    param_regs(std::move(other.param_regs)),
+    param_types(std::move(other.param_types)),
+    label(std::move(other.label)),
+    def_use(std::exchange(other.def_use, nullptr)) {}
+
+BasicBlock::~BasicBlock() {
+    if (is_indexed()) {
+        for (InstrIter iter = instrs.begin(); iter != instrs.end(); ++iter) {
+            def_use->remove_instr(iter);
+        }
+    }
+}
+
+BasicBlock &BasicBlock::operator=(const BasicBlock &other) {
+    return *this = BasicBlock(other);
+}
+
+BasicBlock &BasicBlock::operator=(BasicBlock &&other) noexcept {
+    if (is_indexed()) {
+        for (InstrIter iter = instrs.begin(); iter != instrs.end(); ++iter) {
+            def_use->remove_instr(iter);
+        }
+    }
+
+    instrs = std::move(other.instrs);
+    param_regs = std::move(other.param_regs);
+    param_types = std::move(other.param_types);
+    label = std::move(other.label);
+
+    if (is_indexed()) {
+        for (InstrIter iter = instrs.begin(); iter != instrs.end(); ++iter) {
+            def_use->add_instr(*this, iter);
+        }
+    }
+
+    return *this;
+}
+
 bool BasicBlock::has_label() const {
     return !label.empty();
 }
 
 InstrIter BasicBlock::append(Instruction instr) {
-    return instrs.append(std::move(instr));
+    InstrIter iter = instrs.append(std::move(instr));
+
+    if (is_indexed()) {
+        def_use->add_instr(*this, iter);
+    }
+
+    return iter;
 }
 
 InstrIter BasicBlock::insert_before(InstrIter iter, Instruction instr) {
-    return instrs.insert_before(iter, std::move(instr));
+    InstrIter new_iter = instrs.insert_before(iter, std::move(instr));
+
+    if (is_indexed()) {
+        def_use->add_instr(*this, new_iter);
+    }
+
+    return new_iter;
 }
 
 InstrIter BasicBlock::insert_after(InstrIter iter, Instruction instr) {
-    return instrs.insert_after(iter, std::move(instr));
+    InstrIter new_iter = instrs.insert_after(iter, std::move(instr));
+
+    if (is_indexed()) {
+        def_use->add_instr(*this, new_iter);
+    }
+
+    return new_iter;
 }
 
 void BasicBlock::remove(InstrIter iter) {
+    if (is_indexed()) {
+        def_use->remove_instr(iter);
+    }
+
     instrs.remove(iter);
 }
 
 InstrIter BasicBlock::replace(InstrIter iter, Instruction instr) {
-    return instrs.replace(iter, std::move(instr));
+    if (is_indexed()) {
+        def_use->remove_instr(iter);
+    }
+
+    InstrIter new_iter = instrs.replace(iter, std::move(instr));
+
+    if (is_indexed()) {
+        def_use->add_instr(*this, new_iter);
+    }
+
+    return new_iter;
+}
+
+void BasicBlock::update_def_use(InstrIter iter) {
+    if (is_indexed()) {
+        def_use->update_instr(iter);
+    }
 }
 
 bool BasicBlock::is_branching() const {
     return instrs.get_size() != 0 && instrs.get_last().is_branching();
 }
 
+bool BasicBlock::is_indexed() const {
+    return def_use && def_use->is_valid();
+}
+
 } // namespace ssa
 
 } // namespace banjo
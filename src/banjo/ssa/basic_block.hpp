@@ -11,17 +11,29 @@ namespace banjo {
 
 namespace ssa {
 
+class DefUseIndex;
+
 class BasicBlock {
 
+    friend class DefUseIndex;
+    friend class Function;
+
 private:
     LinkedList<Instruction> instrs;
     std::vector<ssa::VirtualRegister> param_regs;
     std::vector<ssa::Type> param_types;
     std::string label;
+    DefUseIndex *def_use = nullptr;
 
 public:
     BasicBlock(std::string label);
     BasicBlock();
+    BasicBlock(const BasicBlock &other);
+    BasicBlock(BasicBlock &&other) noexcept;
+    ~BasicBlock();
+
+    BasicBlock &operator=(const BasicBlock &other);
+    BasicBlock &operator=(BasicBlock &&other) noexcept;
 
     LinkedList<Instruction> &get_instrs() { return instrs; }
     std::vector<ssa::VirtualRegister> &get_param_regs() { return param_regs; }
@@ -35,6 +47,7 @@ public:
     InstrIter insert_after(InstrIter iter, Instruction instr);
     void remove(InstrIter iter);
     InstrIter replace(InstrIter iter, Instruction instr);
+    void update_def_use(InstrIter iter);
 
     const Instruction &get_entry() const { return instrs.get_first(); }
     InstrIter get_entry_iter() const { return instrs.get_first_iter(); }
@@ -49,6 +62,9 @@ public:
     InstrIter end() { return instrs.end(); }
 
     bool is_branching() const;
+
+private:
+    bool is_indexed() const;
 };
 
 typedef LinkedListNode<BasicBlock> BasicBlockNode;
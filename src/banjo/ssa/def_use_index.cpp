@@ -0,0 +1,177 @@
+#include "def_use_index.hpp"
+
+#include "banjo/ssa/basic_block.hpp"
+#include "banjo/ssa/function.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace banjo {
+
+namespace ssa {
+
+void DefUseIndex::build(Function &func) {
+    invalidate();
+
+    for (BasicBlock &block : func) {
+        block.def_use = this;
+
+        for (InstrIter iter = block.begin(); iter != block.end(); ++iter) {
+            add_instr(block, iter);
+        }
+    }
+
+    valid = true;
+}
+
+void DefUseIndex::invalidate() {
+    valid = false;
+    defs.clear();
+    uses.clear();
+    entries.clear();
+}
+
+void DefUseIndex::add_instr(BasicBlock &block, InstrIter iter) {
+    Entry entry{
+        .block = &block,
+        .dest = iter->get_dest(),
+        .uses = collect_regs(*iter),
+    };
+
+    if (entry.dest) {
+        add_def(*entry.dest, iter);
+    }
+
+    for (VirtualRegister reg : entry.uses) {
+        uses[reg].push_back(iter);
+    }
+
+    entries.insert({iter.get_node(), std::move(entry)});
+}
+
+void DefUseIndex::remove_instr(InstrIter iter) {
+    auto entry_iter = entries.find(iter.get_node());
+    if (entry_iter == entries.end()) {
+        return;
+    }
+
+    Entry &entry = entry_iter->second;
+
+    if (entry.dest) {
+        remove_def(*entry.dest, iter);
+    }
+
+    for (VirtualRegister reg : entry.uses) {
+        remove_use(reg, iter);
+    }
+
+    entries.erase(entry_iter);
+}
+
+void DefUseIndex::update_instr(InstrIter iter) {
+    auto entry_iter = entries.find(iter.get_node());
+    if (entry_iter == entries.end()) {
+        return;
+    }
+
+    Entry &entry = entry_iter->second;
+
+    if (entry.dest != iter->get_dest()) {
+        if (entry.dest) {
+            remove_def(*entry.dest, iter);
+        }
+
+        entry.dest = iter->get_dest();
+
+        if (entry.dest) {
+            add_def(*entry.dest, iter);
+        }
+    }
+
+    std::vector<VirtualRegister> new_uses = collect_regs(*iter);
+
+    for (VirtualRegister reg : entry.uses) {
+        if (std::find(new_uses.begin(), new_uses.end(), reg) == new_uses.end()) {
+            remove_use(reg, iter);
+        }
+    }
+
+    for (VirtualRegister reg : new_uses) {
+        if (std::find(entry.uses.begin(), entry.uses.end(), reg) == entry.uses.end()) {
+            uses[reg].push_back(iter);
+        }
+    }
+
+    entry.uses = std::move(new_uses);
+}
+
+InstrIter DefUseIndex::find_def(VirtualRegister reg) {
+    auto iter = defs.find(reg);
+    return iter == defs.end() ? nullptr : iter->second;
+}
+
+BasicBlock *DefUseIndex::find_def_block(VirtualRegister reg) {
+    InstrIter def = find_def(reg);
+    return def ? entries.at(def.get_node()).block : nullptr;
+}
+
+std::vector<InstrIter> DefUseIndex::find_uses(VirtualRegister reg) {
+    auto iter = uses.find(reg);
+    return iter == uses.end() ? std::vector<InstrIter>{} : iter->second;
+}
+
+void DefUseIndex::add_def(VirtualRegister reg, InstrIter iter) {
+    // Instructions copied into another block are added before the original is removed, so the most recently added
+    // instruction is the definition.
+    defs.insert_or_assign(reg, iter);
+}
+
+void DefUseIndex::remove_def(VirtualRegister reg, InstrIter iter) {
+    auto def_iter = defs.find(reg);
+
+    if (def_iter != defs.end() && def_iter->second == iter) {
+        defs.erase(def_iter);
+    }
+}
+
+void DefUseIndex::remove_use(VirtualRegister reg, InstrIter iter) {
+    auto uses_iter = uses.find(reg);
+    if (uses_iter == uses.end()) {
+        return;
+    }
+
+    std::vector<InstrIter> &reg_uses = uses_iter->second;
+    auto use_iter = std::find(reg_uses.begin(), reg_uses.end(), iter);
+
+    if (use_iter != reg_uses.end()) {
+        reg_uses.erase(use_iter);
+    }
+}
+
+std::vector<VirtualRegister> DefUseIndex::collect_regs(Instruction &instr) {
+    std::vector<VirtualRegister> regs;
+
+    auto add_reg = [&regs](VirtualRegister reg) {
+        if (std::find(regs.begin(), regs.end(), reg) == regs.end()) {
+            regs.push_back(reg);
+        }
+    };
+
+    for (Operand &operand : instr.get_operands()) {
+        if (operand.is_register()) {
+            add_reg(operand.get_register());
+        } else if (operand.is_branch_target()) {
+            for (Operand &arg : operand.get_branch_target().args) {
+                if (arg.is_register()) {
+                    add_reg(arg.get_register());
+                }
+            }
+        }
+    }
+
+    return regs;
+}
+
+} // namespace ssa
+
+} // namespace banjo
@@ -0,0 +1,59 @@
+#ifndef BANJO_SSA_DEF_USE_INDEX_H
+#define BANJO_SSA_DEF_USE_INDEX_H
+
+#include "banjo/ssa/instruction.hpp"
+#include "banjo/ssa/virtual_register.hpp"
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace banjo {
+
+namespace ssa {
+
+class BasicBlock;
+class Function;
+
+// Maps the virtual registers of a function to the instructions defining and using them. The index is built on the
+// first lookup and then kept up to date by the mutating methods of `BasicBlock`. Code that rewrites the operands of
+// an instruction in place has to call `BasicBlock::update_def_use` afterwards. Block parameters are not indexed.
+class DefUseIndex {
+
+private:
+    struct Entry {
+        BasicBlock *block;
+        std::optional<VirtualRegister> dest;
+        std::vector<VirtualRegister> uses;
+    };
+
+    bool valid = false;
+    std::unordered_map<VirtualRegister, InstrIter> defs;
+    std::unordered_map<VirtualRegister, std::vector<InstrIter>> uses;
+    std::unordered_map<InstrNode *, Entry> entries;
+
+public:
+    bool is_valid() const { return valid; }
+    void build(Function &func);
+    void invalidate();
+
+    void add_instr(BasicBlock &block, InstrIter iter);
+    void remove_instr(InstrIter iter);
+    void update_instr(InstrIter iter);
+
+    InstrIter find_def(VirtualRegister reg);
+    BasicBlock *find_def_block(VirtualRegister reg);
+    std::vector<InstrIter> find_uses(VirtualRegister reg);
+
+private:
+    void add_def(VirtualRegister reg, InstrIter iter);
+    void remove_def(VirtualRegister reg, InstrIter iter);
+    void remove_use(VirtualRegister reg, InstrIter iter);
+    static std::vector<VirtualRegister> collect_regs(Instruction &instr);
+};
+
+} // namespace ssa
+
+} // namespace banjo
+
+#endif
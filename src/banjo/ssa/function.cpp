@@ -9,15 +9,23 @@ namespace banjo {
 namespace ssa {
 
 Function::Function(std::string name, FunctionType type) : name(std::move(name)), type(std::move(type)) {
-    basic_blocks.append(BasicBlock());
+    attach_block(basic_blocks.append(BasicBlock()));
+}
+
+Function::~Function() {
+    // Skip updating the index for every instruction while the blocks are destroyed.
+    def_use_index.invalidate();
 }
 
 BasicBlockIter Function::create_block(std::string label) {
-    return basic_blocks.create_iter(std::move(label));
+    BasicBlockIter block = basic_blocks.create_iter(std::move(label));
+    attach_block(block);
+    return block;
 }
 
 void Function::append_block(BasicBlockIter block) {
     basic_blocks.append(block);
+    attach_block(block);
 }
 
 void Function::merge_blocks(BasicBlockIter first, BasicBlockIter second) {
@@ -33,6 +41,7 @@ BasicBlockIter Function::split_block_after(BasicBlockIter block, InstrIter instr
 
     std::string label = "block." + std::to_string(block_index++);
     ssa::BasicBlockIter new_block = basic_blocks.insert_after(block, BasicBlock(label));
+    attach_block(new_block);
 
     for (ssa::InstrIter iter = instr.get_next(); iter != block->end();) {
         new_block->append(*iter);
@@ -45,7 +54,15 @@ BasicBlockIter Function::split_block_after(BasicBlockIter block, InstrIter instr
 
 BasicBlockIter Function::insert_after(BasicBlockIter block) {
     std::string label = "block." + std::to_string(block_index++);
-    return basic_blocks.insert_after(block, BasicBlock(label));
+    BasicBlockIter new_block = basic_blocks.insert_after(block, BasicBlock(label));
+    attach_block(new_block);
+    return new_block;
+}
+
+BasicBlockIter Function::insert_before(BasicBlockIter block, BasicBlock new_block) {
+    BasicBlockIter iter = basic_blocks.insert_before(block, std::move(new_block));
+    attach_block(iter);
+    return iter;
 }
 
 BasicBlockIter Function::find_basic_block(const std::string &label) {
@@ -58,6 +75,14 @@ BasicBlockIter Function::find_basic_block(const std::string &label) {
     return basic_blocks.end();
 }
 
+DefUseIndex &Function::get_def_use_index() {
+    if (!def_use_index.is_valid()) {
+        def_use_index.build(*this);
+    }
+
+    return def_use_index;
+}
+
 VirtualRegister Function::next_virtual_reg() {
     return VirtualRegister(last_virtual_reg++);
 }
@@ -66,6 +91,26 @@ std::string Function::next_float_label() {
     return "float." + std::to_string(last_float_label_id++);
 }
 
+void Function::attach_block(BasicBlockIter block) {
+    LinkedList<Instruction> &instrs = block->get_instrs();
+
+    if (!instrs.get_pool() && instrs.get_size() == 0) {
+        instrs.set_pool(&instr_pool);
+    }
+
+    if (block->def_use == &def_use_index) {
+        return;
+    }
+
+    block->def_use = &def_use_index;
+
+    if (def_use_index.is_valid()) {
+        for (InstrIter instr = block->begin(); instr != block->end(); ++instr) {
+            def_use_index.add_instr(*block, instr);
+        }
+    }
+}
+
 } // namespace ssa
 
 } // namespace banjo
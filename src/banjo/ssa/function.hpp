@@ -2,6 +2,7 @@
 #define BANJO_SSA_FUNCTION_H
 
 #include "banjo/ssa/basic_block.hpp"
+#include "banjo/ssa/def_use_index.hpp"
 #include "banjo/ssa/function_type.hpp"
 #include "banjo/ssa/virtual_register.hpp"
 
@@ -25,6 +26,9 @@ public:
     bool global = false;
     bool never_inline = false;
 
+    // Declared before the blocks so that they outlive them during destruction.
+    LinkedListNodePool<Instruction> instr_pool;
+    DefUseIndex def_use_index;
     LinkedList<BasicBlock> basic_blocks;
 
     ssa::VirtualRegister last_virtual_reg = 0;
@@ -32,6 +36,10 @@ public:
 
 public:
     Function(std::string name, FunctionType type);
+    Function(const Function &) = delete;
+    ~Function();
+
+    Function &operator=(const Function &) = delete;
 
     LinkedList<BasicBlock> &get_basic_blocks() { return basic_blocks; }
 
@@ -43,14 +51,19 @@ public:
     void merge_blocks(BasicBlockIter first, BasicBlockIter second);
     BasicBlockIter split_block_after(BasicBlockIter block, InstrIter instr);
     BasicBlockIter insert_after(BasicBlockIter block);
+    BasicBlockIter insert_before(BasicBlockIter block, BasicBlock new_block);
     BasicBlockIter find_basic_block(const std::string &label);
     VirtualRegister next_virtual_reg();
     std::string next_float_label();
 
     void set_next_reg(ssa::VirtualRegister reg) { last_virtual_reg = reg; }
+    DefUseIndex &get_def_use_index();
 
     BasicBlockIter begin() { return basic_blocks.begin(); }
     BasicBlockIter end() { return basic_blocks.end(); }
+
+private:
+    void attach_block(BasicBlockIter block);
 };
 
 } // namespace ssa
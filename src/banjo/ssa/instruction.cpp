@@ -44,6 +44,7 @@ Type Instruction::get_type() const {
         case Opcode::STOF: return operands[1].get_type();
         case Opcode::FTOU: return operands[1].get_type();
         case Opcode::FTOS: return operands[1].get_type();
+        case Opcode::SPLAT: return operands[1].get_type();
         case Opcode::SELECT: return operands[3].get_type();
         case Opcode::CALL: return dest ? operands[0].get_type() : ssa::Primitive::VOID;
         case Opcode::MEMBERPTR: {
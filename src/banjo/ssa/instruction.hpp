@@ -5,6 +5,7 @@
 #include "banjo/ssa/operand.hpp"
 #include "banjo/ssa/virtual_register.hpp"
 #include "banjo/utils/linked_list.hpp"
+#include "banjo/utils/small_vector.hpp"
 
 #include <cstdint>
 #include <optional>
@@ -23,33 +24,36 @@ public:
         VARIADIC,
     };
 
+    // Most instructions have at most two operands, which are then stored without a separate heap allocation.
+    typedef utils::SmallVector<Operand, 2> OperandList;
+
 private:
     Opcode opcode;
     std::optional<VirtualRegister> dest;
-    std::vector<Operand> operands;
+    OperandList operands;
     Attribute attr = Attribute::NONE;
     unsigned attr_data;
 
 public:
     Instruction() {}
 
-    Instruction(Opcode opcode, std::optional<VirtualRegister> dest, std::vector<Operand> operands)
+    Instruction(Opcode opcode, std::optional<VirtualRegister> dest, OperandList operands)
       : opcode(opcode),
         dest(dest),
         operands(std::move(operands)) {}
 
-    Instruction(Opcode opcode, VirtualRegister dest, std::vector<Operand> operands)
+    Instruction(Opcode opcode, VirtualRegister dest, OperandList operands)
       : opcode(opcode),
         dest{dest},
         operands(std::move(operands)) {}
 
-    Instruction(Opcode opcode, std::vector<Operand> operands) : opcode(opcode), dest{}, operands(std::move(operands)) {}
+    Instruction(Opcode opcode, OperandList operands) : opcode(opcode), dest{}, operands(std::move(operands)) {}
 
     Instruction(Opcode opcode) : opcode(opcode), dest{}, operands{} {}
 
     Opcode get_opcode() const { return opcode; }
     std::optional<VirtualRegister> &get_dest() { return dest; }
-    std::vector<Operand> &get_operands() { return operands; }
+    OperandList &get_operands() { return operands; }
     Operand &get_operand(int index) { return operands[index]; }
     Attribute get_attr() const { return attr; }
     unsigned get_attr_data() const { return attr_data; }
@@ -46,6 +46,7 @@ enum class Opcode {
     OFFSETPTR,
     COPY,
     SQRT,
+    SPLAT,
 };
 
 } // namespace ssa
@@ -17,6 +17,9 @@ enum class Primitive {
     U64,
     F32,
     F64,
+    F32X4,
+    F64X2,
+    I32X4,
     ADDR,
 };
 
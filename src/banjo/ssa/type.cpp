@@ -34,7 +34,34 @@ bool Type::is_floating_point() const {
 }
 
 bool Type::is_integer() const {
-    return array_length == 1 && !is_floating_point();
+    return array_length == 1 && !is_floating_point() && !is_vector();
+}
+
+bool Type::is_vector() const {
+    if (array_length != 1 || !is_primitive()) {
+        return false;
+    }
+
+    return get_primitive() == Primitive::F32X4 || get_primitive() == Primitive::F64X2 ||
+           get_primitive() == Primitive::I32X4;
+}
+
+Primitive Type::get_vector_element() const {
+    switch (get_primitive()) {
+        case Primitive::F32X4: return Primitive::F32;
+        case Primitive::F64X2: return Primitive::F64;
+        case Primitive::I32X4: return Primitive::I32;
+        default: ASSERT_UNREACHABLE;
+    }
+}
+
+unsigned Type::get_vector_length() const {
+    switch (get_primitive()) {
+        case Primitive::F32X4: return 4;
+        case Primitive::F64X2: return 2;
+        case Primitive::I32X4: return 4;
+        default: ASSERT_UNREACHABLE;
+    }
 }
 
 bool Type::is_struct_aggregate() const {
@@ -49,6 +49,9 @@ public:
     bool is_primitive(Primitive primitive) const;
     bool is_floating_point() const;
     bool is_integer() const;
+    bool is_vector() const;
+    Primitive get_vector_element() const;
+    unsigned get_vector_length() const;
     bool is_struct_aggregate() const;
 
     friend bool operator==(const Type &left, const Type &right) {
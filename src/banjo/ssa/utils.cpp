@@ -44,6 +44,7 @@ Type get_result_type(Instruction &instr, Type addr_type) {
         case Opcode::OFFSETPTR: return addr_type;
         case Opcode::COPY: return Primitive::VOID;
         case Opcode::SQRT: return instr.get_operand(0).get_type();
+        case Opcode::SPLAT: return instr.get_operand(1).get_type();
     }
 }
 
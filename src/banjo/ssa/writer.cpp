@@ -201,6 +201,7 @@ void Writer::write_basic_block(BasicBlock &basic_block) {
             case Opcode::OFFSETPTR: opcode = "offsetptr"; break;
             case Opcode::COPY: opcode = "copy"; break;
             case Opcode::SQRT: opcode = "sqrt"; break;
+            case Opcode::SPLAT: opcode = "splat"; break;
         }
 
         stream << opcode;
@@ -261,6 +262,9 @@ std::string Writer::type_to_str(Type type) {
             case Primitive::I64: str = "i64"; break;
             case Primitive::F32: str = "f32"; break;
             case Primitive::F64: str = "f64"; break;
+            case Primitive::F32X4: str = "f32x4"; break;
+            case Primitive::F64X2: str = "f64x2"; break;
+            case Primitive::I32X4: str = "i32x4"; break;
             case Primitive::ADDR: str = "addr"; break;
         }
     } else if (type.is_struct()) {
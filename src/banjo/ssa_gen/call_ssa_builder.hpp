@@ -1,6 +1,7 @@
 #ifndef BANJO_SSA_GEN_CALL_SSA_BUILDER_H
 #define BANJO_SSA_GEN_CALL_SSA_BUILDER_H
 
+#include "banjo/ssa/instruction.hpp"
 #include "banjo/ssa/operand.hpp"
 #include "banjo/ssa_gen/ssa_generator_context.hpp"
 #include "banjo/ssa_gen/storage_hints.hpp"
@@ -19,7 +20,7 @@ private:
     const StorageHints &hints;
 
     ReturnMethod return_method;
-    std::vector<ssa::Operand> ssa_operands;
+    ssa::Instruction::OperandList ssa_operands;
     StoredValue return_value_ptr;
     std::optional<unsigned> first_variadic_index;
 
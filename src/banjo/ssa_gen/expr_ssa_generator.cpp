@@ -159,16 +159,35 @@ void ExprSSAGenerator::generate_branch(const sir::Expr &expr, CondBranchTargets
 
 StoredValue ExprSSAGenerator::generate_int_literal(const sir::IntLiteral &int_literal) {
     ssa::Type ssa_type = TypeSSAGenerator(ctx).generate(int_literal.type);
+
+    if (ssa_type.is_vector()) {
+        ssa::Value ssa_immediate = ssa::Value::from_int_immediate(int_literal.value, ssa_type.get_vector_element());
+        return generate_splat(ssa_immediate, ssa_type);
+    }
+
     ssa::Value ssa_immediate = ssa::Value::from_int_immediate(int_literal.value, ssa_type);
     return StoredValue::create_value(ssa_immediate);
 }
 
 StoredValue ExprSSAGenerator::generate_fp_literal(const sir::FPLiteral &fp_literal) {
     ssa::Type ssa_type = TypeSSAGenerator(ctx).generate(fp_literal.type);
+
+    if (ssa_type.is_vector()) {
+        ssa::Value ssa_immediate = ssa::Value::from_fp_immediate(fp_literal.value, ssa_type.get_vector_element());
+        return generate_splat(ssa_immediate, ssa_type);
+    }
+
     ssa::Value ssa_immediate = ssa::Value::from_fp_immediate(fp_literal.value, ssa_type);
     return StoredValue::create_value(ssa_immediate);
 }
 
+StoredValue ExprSSAGenerator::generate_splat(ssa::Value ssa_scalar, ssa::Type ssa_vector_type) {
+    ssa::VirtualRegister ssa_reg = ctx.next_vreg();
+    ssa::Value ssa_type_operand = ssa::Value::from_type(ssa_vector_type);
+    ctx.get_ssa_block()->append(ssa::Instruction(ssa::Opcode::SPLAT, ssa_reg, {ssa_scalar, ssa_type_operand}));
+    return StoredValue::create_value(ssa::Value::from_register(ssa_reg, ssa_vector_type));
+}
+
 StoredValue ExprSSAGenerator::generate_bool_literal(const sir::BoolLiteral &bool_literal) {
     unsigned value = bool_literal.value ? 1 : 0;
     ssa::Type ssa_type = TypeSSAGenerator(ctx).generate(bool_literal.type);
@@ -198,10 +217,17 @@ StoredValue ExprSSAGenerator::generate_array_literal(
     const sir::ArrayLiteral &array_literal,
     const StorageHints &hints
 ) {
-    const sir::Expr &element_type = array_literal.type.as<sir::StaticArrayType>().base_type;
-
     ssa::Type ssa_array_type = TypeSSAGenerator(ctx).generate(array_literal.type);
-    ssa::Type ssa_element_type = TypeSSAGenerator(ctx).generate(element_type);
+    ssa::Type ssa_element_type;
+
+    // Array literals coerced to a vector type are built in memory lane by lane and loaded as a whole.
+    if (ssa_array_type.is_vector()) {
+        ssa_element_type = ssa_array_type.get_vector_element();
+    } else {
+        const sir::Expr &element_type = array_literal.type.as<sir::StaticArrayType>().base_type;
+        ssa_element_type = TypeSSAGenerator(ctx).generate(element_type);
+    }
+
     StoredValue stored_val = StoredValue::alloc(ssa_array_type, hints, ctx);
 
     for (unsigned i = 0; i < array_literal.values.size(); i++) {
@@ -343,7 +369,7 @@ StoredValue ExprSSAGenerator::generate_binary_expr(const sir::BinaryExpr &binary
 
     sir::Expr lhs_type = ctx.resolve_if_generic(binary_expr.lhs.get_type());
 
-    if (lhs_type.is_int_type()) {
+    if (lhs_type.is_int_type() || lhs_type.is_primitive_type(sir::Primitive::I32X4)) {
         bool is_unsigned = lhs_type.is_unsigned_type();
         ssa::Opcode ssa_op;
 
@@ -363,7 +389,7 @@ StoredValue ExprSSAGenerator::generate_binary_expr(const sir::BinaryExpr &binary
 
         reg = ctx.next_vreg();
         ctx.get_ssa_block()->append({ssa_op, reg, {ssa_lhs, ssa_rhs}});
-    } else if (lhs_type.is_fp_type()) {
+    } else if (lhs_type.is_fp_type() || lhs_type.is_vector_type()) {
         ssa::Opcode ssa_op;
 
         switch (binary_expr.op) {
@@ -525,6 +551,10 @@ StoredValue ExprSSAGenerator::generate_index_expr(const sir::IndexExpr &index_ex
         ssa::Value ssa_base = generate(index_expr.base).get_ptr();
         ssa::VirtualRegister ssa_reg = ctx.append_offsetptr(ssa_base, ssa_offset, ssa_type);
         return StoredValue::create_reference(ssa::Value::from_register(ssa_reg, ssa::Primitive::ADDR), ssa_type);
+    } else if (base_type.is_vector_type()) {
+        ssa::Value ssa_base = generate(index_expr.base).turn_into_reference(ctx).get_ptr();
+        ssa::VirtualRegister ssa_reg = ctx.append_offsetptr(ssa_base, ssa_offset, ssa_type);
+        return StoredValue::create_reference(ssa::Value::from_register(ssa_reg, ssa::Primitive::ADDR), ssa_type);
     } else {
         ASSERT_UNREACHABLE;
     }
@@ -573,10 +603,8 @@ StoredValue ExprSSAGenerator::generate_call_expr(const sir::CallExpr &call_expr,
     CallSSABuilder ssa_builder{ctx, ssa_type, hints};
 
     if (concrete_proto) {
-        utils::Arena arena;
-
         if (auto specialization = ctx.get_specialization()) {
-            sir::Specializer specializer{arena, specialization->params, specialization->args};
+            sir::Specializer specializer{ctx.type_interner, specialization->params, specialization->args};
             concrete_proto->generic_args = specializer.specialize_expr_list(concrete_proto->generic_args);
         }
 
@@ -623,8 +651,6 @@ StoredValue ExprSSAGenerator::generate_field_expr(const sir::FieldExpr &field_ex
 }
 
 StoredValue ExprSSAGenerator::generate_try_expr(const sir::TryExpr &try_expr, const StorageHints &hints) {
-    utils::Arena arena;
-
     sir::Concrete<sir::StructDef> return_struct_def = try_expr.return_type.as_concrete<sir::StructDef>();
     sir::Concrete<sir::StructDef> struct_def = try_expr.value.get_type().as_concrete<sir::StructDef>();
 
@@ -650,7 +676,7 @@ StoredValue ExprSSAGenerator::generate_try_expr(const sir::TryExpr &try_expr, co
     ctx.append_block(ssa_return_branch);
 
     sir::Expr concrete_error_type =
-        sir::Specializer{arena, struct_def}.specialize_expr(unwrap_error_func.type.return_type);
+        sir::Specializer{ctx.type_interner, struct_def}.specialize_expr(unwrap_error_func.type.return_type);
     ssa::Type ssa_error_type = TypeSSAGenerator(ctx).generate(concrete_error_type);
 
     StoredValue ssa_error = CallSSABuilder{ctx, ssa_error_type, StorageHints::none()}
@@ -659,7 +685,7 @@ StoredValue ExprSSAGenerator::generate_try_expr(const sir::TryExpr &try_expr, co
                                 .generate();
 
     sir::Expr concrete_result_type =
-        sir::Specializer{arena, return_struct_def}.specialize_expr(error_init_func.type.return_type);
+        sir::Specializer{ctx.type_interner, return_struct_def}.specialize_expr(error_init_func.type.return_type);
     ssa::Type ssa_result_type = TypeSSAGenerator(ctx).generate(concrete_result_type);
     ssa::VirtualRegister ssa_return_slot = ctx.get_func_context().ssa_return_slot;
 
@@ -748,11 +774,10 @@ StoredValue ExprSSAGenerator::generate_coercion_expr(
 }
 
 StoredValue ExprSSAGenerator::generate_specialize_expr(const sir::SpecializeExpr &specialize_expr) {
-    utils::Arena arena;
     std::span<sir::Expr> args = specialize_expr.args;
 
     if (auto specialization = ctx.get_specialization()) {
-        sir::Specializer specializer{arena, specialization->params, specialization->args};
+        sir::Specializer specializer{ctx.type_interner, specialization->params, specialization->args};
         args = specializer.specialize_expr_list(args);
     }
 
@@ -35,6 +35,7 @@ public:
 private:
     StoredValue generate_int_literal(const sir::IntLiteral &int_literal);
     StoredValue generate_fp_literal(const sir::FPLiteral &fp_literal);
+    StoredValue generate_splat(ssa::Value ssa_scalar, ssa::Type ssa_vector_type);
     StoredValue generate_bool_literal(const sir::BoolLiteral &bool_literal);
     StoredValue generate_char_literal(const sir::CharLiteral &char_literal);
     StoredValue generate_null_literal(const sir::NullLiteral &null_literal);
@@ -47,6 +47,9 @@ static void mangle_type(std::string &string, const sir::Expr &type) {
             case sir::Primitive::USIZE: string += "u4"; break;
             case sir::Primitive::F32: string += "f0"; break;
             case sir::Primitive::F64: string += "f1"; break;
+            case sir::Primitive::F32X4: string += "x0"; break;
+            case sir::Primitive::F64X2: string += "x1"; break;
+            case sir::Primitive::I32X4: string += "x2"; break;
             case sir::Primitive::BOOL: string += "b0"; break;
             case sir::Primitive::ADDR: string += "a0"; break;
             case sir::Primitive::VOID: string += "v0"; break;
@@ -22,7 +22,9 @@ sir::Expr SpecializationCollector::Entry::resolve_param(const sir::GenericParam
     ASSERT_UNREACHABLE;
 }
 
-SpecializationCollector::SpecializationCollector(utils::Arena &arena) : arena{arena} {}
+SpecializationCollector::SpecializationCollector(sir::TypeInterner &type_interner)
+  : type_interner{type_interner},
+    arena{type_interner.get_arena()} {}
 
 SpecializationCollector::List SpecializationCollector::collect(const sir::Unit &unit) {
     for (const sir::Module *mod : unit.mods) {
@@ -170,7 +172,7 @@ void SpecializationCollector::visit_meta_for_stmt(const sir::MetaForStmt &meta_f
 
     if (!entry_stack.empty()) {
         SpecializationCollector::Entry &entry = entry_stack.back();
-        sequence_type = sir::Specializer{arena, entry.params, entry.args}.specialize_expr(sequence_type);
+        sequence_type = sir::Specializer{type_interner, entry.params, entry.args}.specialize_expr(sequence_type);
     }
 
     std::span<sir::Expr> sir_types;
@@ -188,7 +190,7 @@ void SpecializationCollector::visit_meta_for_stmt(const sir::MetaForStmt &meta_f
 
         if (!entry_stack.empty()) {
             SpecializationCollector::Entry &entry = entry_stack.back();
-            base_type = sir::Specializer{arena, entry.params, entry.args}.specialize_expr(base_type);
+            base_type = sir::Specializer{type_interner, entry.params, entry.args}.specialize_expr(base_type);
         }
 
         if (auto struct_def = base_type.match_symbol<sir::StructDef>()) {
@@ -218,6 +220,7 @@ void SpecializationCollector::visit_meta_for_stmt(const sir::MetaForStmt &meta_f
             .symbol = nullptr,
             .params = arena.create_array({param}),
             .args{sir_type},
+            .hash = sir::TypeInterner::compute_list_hash({&sir_type, 1}),
             .resources{},
         };
 
@@ -463,18 +466,19 @@ void SpecializationCollector::visit_placeholder_expr(const sir::PlaceholderExpr
 }
 
 void SpecializationCollector::visit_concrete(sir::Symbol symbol, std::span<sir::Expr> args) {
-    std::vector<sir::Expr> args_full(args.begin(), args.end());
+    std::span<sir::Expr> canonical_args;
 
-    if (!entry_stack.empty()) {
+    if (entry_stack.empty()) {
+        canonical_args = type_interner.intern_list(args);
+    } else {
         SpecializationCollector::Entry &entry = entry_stack.back();
-
-        sir::Specializer specializer{arena, entry.params, entry.args};
-        std::span<sir::Expr> specialized_args = specializer.specialize_expr_list(args_full);
-        args_full.assign(specialized_args.begin(), specialized_args.end());
+        canonical_args = sir::Specializer{type_interner, entry.params, entry.args}.specialize_expr_list(args);
     }
 
+    std::size_t hash = sir::TypeInterner::compute_list_hash(canonical_args);
+
     for (Entry &entry : entry_stack) {
-        if (entry.symbol == symbol && entry.args == args_full) {
+        if (entry.symbol == symbol && entry.hash == hash && utils::equal(entry.args, canonical_args)) {
             return;
         }
     }
@@ -482,7 +486,7 @@ void SpecializationCollector::visit_concrete(sir::Symbol symbol, std::span<sir::
     std::vector<Entry> &entries = specializations.symbol_entries[symbol];
 
     for (Entry &entry : entries) {
-        if (entry.args == args_full) {
+        if (entry.hash == hash && utils::equal(entry.args, canonical_args)) {
             return;
         }
     }
@@ -491,7 +495,8 @@ void SpecializationCollector::visit_concrete(sir::Symbol symbol, std::span<sir::
         Entry{
             .symbol = symbol,
             .params = symbol.get_generic_params(),
-            .args = args_full,
+            .args = std::vector<sir::Expr>(canonical_args.begin(), canonical_args.end()),
+            .hash = hash,
         }
     );
 
@@ -16,6 +16,7 @@ public:
         sir::Symbol symbol;
         std::span<sir::GenericParam *> params;
         std::vector<sir::Expr> args;
+        std::size_t hash;
         std::unordered_map<const sir::Resource *, sir::Resource> resources;
 
         sir::Expr resolve_param(const sir::GenericParam &param);
@@ -27,12 +28,13 @@ public:
     };
 
 private:
+    sir::TypeInterner &type_interner;
     utils::Arena &arena;
     List specializations;
     std::vector<Entry> entry_stack;
 
 public:
-    SpecializationCollector(utils::Arena &arena);
+    SpecializationCollector(sir::TypeInterner &type_interner);
     List collect(const sir::Unit &unit);
 
 private:
@@ -32,7 +32,7 @@ ssa::Module SSAGenerator::generate() {
     PROFILE_SCOPE("ssa generator");
 
     ctx.ssa_mod = &ssa_mod;
-    ctx.specializations = SpecializationCollector{arena}.collect(sir_unit);
+    ctx.specializations = SpecializationCollector{ctx.type_interner}.collect(sir_unit);
 
     // for (const auto &[key, value] : ctx.specializations) {
     //     std::cout << key.get_name() << "\n";
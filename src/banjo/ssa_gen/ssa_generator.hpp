@@ -6,7 +6,6 @@
 #include "banjo/ssa/structure.hpp"
 #include "banjo/ssa_gen/ssa_generator_context.hpp"
 #include "banjo/target/target.hpp"
-#include "banjo/utils/arena.hpp"
 
 #include <vector>
 
@@ -18,7 +17,6 @@ private:
     const sir::Unit &sir_unit;
     ssa::Module ssa_mod;
     SSAGeneratorContext ctx;
-    utils::Arena arena;
 
 public:
     SSAGenerator(const sir::Unit &sir_unit, target::Target *target);
@@ -82,8 +82,7 @@ bool SSAGeneratorContext::is_type_check_satisfied(const sir::TypeCheckExpr &type
     };
 
     if (SpecializationCollector::Entry *specialization = get_specialization()) {
-        utils::Arena arena;
-        sir::Specializer specializer{arena, specialization->params, specialization->args};
+        sir::Specializer specializer{type_interner, specialization->params, specialization->args};
 
         return sir::satisfies_type_constraint(constraint, type, specializer);
     } else {
@@ -168,7 +167,7 @@ void SSAGeneratorContext::append_cjmp(
         return;
     }
 
-    std::vector<ssa::Operand> operands{
+    ssa::Instruction::OperandList operands{
         std::move(lhs),
         ssa::Operand::from_comparison(comparison),
         std::move(rhs),
@@ -190,7 +189,7 @@ void SSAGeneratorContext::append_fcjmp(
         return;
     }
 
-    std::vector<ssa::Operand> operands{
+    ssa::Instruction::OperandList operands{
         std::move(lhs),
         ssa::Operand::from_comparison(comparison),
         std::move(rhs),
@@ -224,7 +223,7 @@ void SSAGeneratorContext::append_memberptr(
     ssa::Operand base,
     unsigned member
 ) {
-    std::vector<ssa::Operand> operands{
+    ssa::Instruction::OperandList operands{
         ssa::Value::from_type(type),
         std::move(base),
         ssa::Operand::from_int_immediate(member),
@@ -39,10 +39,15 @@ struct MonoDeclMap {
     std::unordered_map<const Key *, Value> direct_map;
     std::unordered_map<const Key *, std::vector<MonoItem>> mono_map;
 
+    // Indices into `mono_map` by the hash of the generic arguments.
+    std::unordered_map<const Key *, std::unordered_map<std::size_t, std::vector<unsigned>>> mono_index;
+
     void insert(const Key *key, Value value) { direct_map.emplace(key, value); }
 
     void insert(const Key *key, SpecializationCollector::Entry &specialization, Value value) {
-        mono_map[key].push_back({specialization, value});
+        std::vector<MonoItem> &mono_items = mono_map[key];
+        mono_index[key][specialization.hash].push_back(mono_items.size());
+        mono_items.push_back({specialization, value});
     }
 
     Value &find(const Key *key) { return direct_map.at(key); }
@@ -57,9 +62,12 @@ struct MonoDeclMap {
             return direct_map.at(key.def);
         }
 
-        for (MonoItem &mono_item : mono_map.at(key.def)) {
-            if (utils::equal(mono_item.specialization.args, key.generic_args)) {
-                return mono_item.value;
+        std::vector<MonoItem> &mono_items = mono_map.at(key.def);
+        std::size_t hash = sir::TypeInterner::compute_list_hash(key.generic_args);
+
+        for (unsigned index : mono_index.at(key.def).at(hash)) {
+            if (utils::equal(mono_items[index].specialization.args, key.generic_args)) {
+                return mono_items[index].value;
             }
         }
 
@@ -105,6 +113,7 @@ public:
     std::stack<FuncContext> func_contexts;
     std::stack<LoopContext> loop_contexts;
 
+    sir::TypeInterner type_interner;
     SpecializationCollector::List specializations;
 
     MonoDeclMap<sir::FuncDef, ssa::Function *> ssa_funcs;
@@ -52,6 +52,9 @@ ssa::Type TypeSSAGenerator::generate_primitive_type(const sir::PrimitiveType &pr
         case sir::Primitive::USIZE: return ctx.target->get_data_layout().get_usize_type();
         case sir::Primitive::F32: return ssa::Primitive::F32;
         case sir::Primitive::F64: return ssa::Primitive::F64;
+        case sir::Primitive::F32X4: return ssa::Primitive::F32X4;
+        case sir::Primitive::F64X2: return ssa::Primitive::F64X2;
+        case sir::Primitive::I32X4: return ssa::Primitive::I32X4;
         case sir::Primitive::BOOL: return ssa::Primitive::U8;
         case sir::Primitive::ADDR: return ssa::Primitive::ADDR;
         case sir::Primitive::VOID: return ssa::Primitive::VOID;
@@ -131,11 +134,10 @@ ssa::Type TypeSSAGenerator::generate_reference_type() {
 }
 
 ssa::Type TypeSSAGenerator::generate_specialize_type(const sir::SpecializeExpr &specialize_type) {
-    utils::Arena arena;
     std::span<sir::Expr> args = specialize_type.args;
 
     if (auto specialization = ctx.get_specialization()) {
-        sir::Specializer specializer{arena, specialization->params, specialization->args};
+        sir::Specializer specializer{ctx.type_interner, specialization->params, specialization->args};
         args = specializer.specialize_expr_list(args);
     }
 
@@ -16,14 +16,8 @@ const std::unordered_set<mcode::Opcode> REMOVABLE_INSTRS = {
     AArch64Opcode::MUL,
 };
 
-void AArch64InstrMergePass::run(mcode::Module &module_) {
-    for (mcode::Function *func : module_.get_functions()) {
-        run(func);
-    }
-}
-
-void AArch64InstrMergePass::run(mcode::Function *func) {
-    for (mcode::BasicBlock &basic_block : func->get_basic_blocks()) {
+void AArch64InstrMergePass::run(mcode::Function &func) {
+    for (mcode::BasicBlock &basic_block : func.get_basic_blocks()) {
         run(basic_block);
     }
 }
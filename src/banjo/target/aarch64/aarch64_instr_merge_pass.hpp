@@ -21,8 +21,7 @@ private:
     typedef std::unordered_map<int, RegUsage> RegUsageMap;
 
 public:
-    void run(mcode::Module &module_);
-    void run(mcode::Function *func);
+    void run(mcode::Function &func) override;
     void run(mcode::BasicBlock &basic_block);
 
 private:
@@ -761,16 +761,22 @@ mcode::Operand AArch64SSALowerer::move_float_into_register(double value, unsigne
         move_elements_into_register(bits_value, elements);
         emit({AArch64Opcode::FMOV, {result, bits_value}});
     } else {
-        mcode::Global global{
-            .name = "double." + std::to_string(next_const_index++),
-            .size = 8,
-            .alignment = 8,
-            .value = value,
-        };
-
-        get_machine_module().add(global);
+        std::uint64_t bits = utils::get_bits_64(value);
+        std::string label = "double." + utils::to_hex_string(bits, 16);
+
+        if (!const_f64s.contains(bits)) {
+            mcode::Global global{
+                .name = label,
+                .size = 8,
+                .alignment = 8,
+                .value = value,
+            };
+
+            get_machine_module().add(global);
+            const_f64s.insert(bits);
+        }
 
-        mcode::Operand symbol_addr = mcode::Operand::from_register(move_symbol_into_register(global.name), 8);
+        mcode::Operand symbol_addr = mcode::Operand::from_register(move_symbol_into_register(label), 8);
         AArch64Address addr = AArch64Address::new_base(symbol_addr.get_register());
         mcode::Operand m_addr = mcode::Operand::from_aarch64_addr(addr);
         emit({AArch64Opcode::LDR, {result, m_addr}, mcode::Instruction::FLAG_FLOAT});
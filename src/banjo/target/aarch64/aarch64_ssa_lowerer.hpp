@@ -9,13 +9,14 @@
 #include <cstdint>
 #include <span>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace banjo::target {
 
 class AArch64SSALowerer : public codegen::SSALowerer {
 
 private:
-    unsigned next_const_index = 0;
+    std::unordered_set<std::uint64_t> const_f64s;
     std::unordered_map<ssa::VirtualRegister, ssa::VirtualRegister> block_arg_tmps;
 
 public:
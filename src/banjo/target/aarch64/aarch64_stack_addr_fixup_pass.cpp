@@ -14,11 +14,9 @@
 
 namespace banjo::target {
 
-void AArch64StackAddrFixupPass::run(mcode::Module &mod) {
-    for (mcode::Function *func : mod.get_functions()) {
-        for (mcode::BasicBlock &block : *func) {
-            run(block);
-        }
+void AArch64StackAddrFixupPass::run(mcode::Function &func) {
+    for (mcode::BasicBlock &block : func) {
+        run(block);
     }
 }
 
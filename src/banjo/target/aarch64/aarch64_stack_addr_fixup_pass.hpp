@@ -12,7 +12,7 @@ private:
     mcode::BasicBlock *block;
 
 public:
-    void run(mcode::Module &mod);
+    void run(mcode::Function &func) override;
 
 private:
     void run(mcode::BasicBlock &block);
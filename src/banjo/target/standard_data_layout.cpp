@@ -23,6 +23,9 @@ unsigned StandardDataLayout::get_size(const ssa::Type &type) const {
             case ssa::Primitive::I64: return 8 * type.get_array_length();
             case ssa::Primitive::F32: return 4 * type.get_array_length();
             case ssa::Primitive::F64: return 8 * type.get_array_length();
+            case ssa::Primitive::F32X4: return 16 * type.get_array_length();
+            case ssa::Primitive::F64X2: return 16 * type.get_array_length();
+            case ssa::Primitive::I32X4: return 16 * type.get_array_length();
             case ssa::Primitive::ADDR: return get_size(get_usize_type()) * type.get_array_length();
         }
     } else if (type.is_struct()) {
@@ -40,6 +40,8 @@ public:
     virtual std::vector<std::unique_ptr<codegen::MachinePass>> create_passes() = 0;
     virtual std::string get_output_file_ext() = 0;
     virtual codegen::Emitter *create_emitter(mcode::Module &module, std::ostream &stream) = 0;
+    virtual bool supports_parallel_codegen() { return true; }
+    virtual bool supports_build_cache() { return false; }
     ssa::CallingConv get_default_calling_conv();
 
     static Target *create(TargetDescription descr, CodeModel code_model);
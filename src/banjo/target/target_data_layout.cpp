@@ -10,6 +10,11 @@ namespace banjo::target {
 TargetDataLayout::TargetDataLayout(Params params) : params(params) {}
 
 bool TargetDataLayout::fits_in_register(const ssa::Type &type) const {
+    // Vectors are kept in the SIMD registers of the target.
+    if (type.is_vector()) {
+        return true;
+    }
+
     if (!params.supports_structs_in_regs) {
         if (type.get_array_length() != 1) {
             return false;
@@ -22,6 +27,14 @@ bool TargetDataLayout::fits_in_register(const ssa::Type &type) const {
 }
 
 ArgPassMethod TargetDataLayout::get_arg_pass_method(const ssa::Type &type) const {
+    if (type.is_vector()) {
+        if (params.vector_args_via_pointer) {
+            return ArgPassMethod{.via_pointer = true, .num_args = 1, .last_arg_type = get_usize_type()};
+        } else {
+            return ArgPassMethod{.via_pointer = false, .num_args = 1, .last_arg_type = type};
+        }
+    }
+
     if (!params.supports_structs_in_regs) {
         if (type.get_array_length() != 1) {
             return ArgPassMethod{.via_pointer = true, .num_args = 1, .last_arg_type = get_usize_type()};
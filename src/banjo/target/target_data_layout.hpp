@@ -22,6 +22,7 @@ public:
         ssa::Type usize_type;
         unsigned max_regs_per_arg;
         bool supports_structs_in_regs;
+        bool vector_args_via_pointer = false;
     };
 
 protected:
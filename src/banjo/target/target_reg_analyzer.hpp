@@ -19,6 +19,10 @@ struct SpilledRegUse {
     mcode::StackSlotID stack_slot;
     mcode::PhysicalReg reg;
     codegen::RegClass reg_class;
+
+    // Whether the stack slot may replace a register operand of the instruction instead of inserting a move. This
+    // is not possible if the value also has to be available in the register.
+    bool allow_folding = true;
 };
 
 class TargetRegAnalyzer {
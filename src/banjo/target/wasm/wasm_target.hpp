@@ -24,6 +24,9 @@ public:
     std::vector<std::unique_ptr<codegen::MachinePass>> create_passes() override;
     std::string get_output_file_ext() override;
     codegen::Emitter *create_emitter(mcode::Module &module, std::ostream &stream) override;
+
+    // The lowerer collects indirect call types and imports in module-wide target data.
+    bool supports_parallel_codegen() override { return false; }
 };
 
 } // namespace banjo::target
@@ -141,7 +141,7 @@ void MSABICallingConv::emit_call(codegen::SSALowerer &lowerer, const ssa::Operan
         operand = x86_64_lowerer.read_symbol_addr(func_operand.get_symbol_name());
     } else if (func_operand.is_register()) {
         ssa::InstrIter producer = lowerer.get_producer(func_operand.get_register());
-        if (producer->get_opcode() == ssa::Opcode::LOAD) {
+        if (producer != lowerer.get_block().end() && producer->get_opcode() == ssa::Opcode::LOAD) {
             codegen::SSALowerer::AddrComponents addr = lowerer.collect_addr(producer->get_operand(1));
             operand = x86_64_lowerer.lower_addr_mem_access(addr);
             lowerer.discard_use(func_operand.get_register());
@@ -156,7 +156,8 @@ void MSABICallingConv::emit_call(codegen::SSALowerer &lowerer, const ssa::Operan
 void MSABICallingConv::emit_ret_val_move(codegen::SSALowerer &lowerer) {
     ssa::Instruction &instr = *lowerer.get_instr_iter();
 
-    bool is_floating_point = instr.get_operand(0).get_type().is_floating_point();
+    ssa::Type return_type = instr.get_operand(0).get_type();
+    bool is_floating_point = return_type.is_floating_point() || return_type.is_vector();
     unsigned return_size = lowerer.get_size(instr.get_operand(0).get_type());
 
     mcode::Opcode opcode;
@@ -170,6 +171,8 @@ void MSABICallingConv::emit_ret_val_move(codegen::SSALowerer &lowerer) {
             opcode = X8664Opcode::MOVSS;
         } else if (return_size == 8) {
             opcode = X8664Opcode::MOVSD;
+        } else if (return_size == 16) {
+            opcode = X8664Opcode::MOVUPS;
         } else {
             ASSERT_UNREACHABLE;
         }
@@ -244,7 +247,7 @@ void MSABICallingConv::create_implicit_region(
         if (reg >= RAX && reg <= R15) {
             saved_reg_space_size += 8;
         } else {
-            unsigned index = frame.new_stack_slot({mcode::StackSlot::Type::GENERIC, 8, 8});
+            unsigned index = frame.new_stack_slot({mcode::StackSlot::Type::GENERIC, 16, 8});
             frame.get_reg_save_slot_indices().push_back(index);
         }
     }
@@ -304,9 +307,9 @@ std::vector<mcode::Instruction> MSABICallingConv::get_prolog(mcode::Function *fu
         if (reg >= XMM0 && reg <= XMM15) {
             unsigned slot_index = func->get_stack_frame().get_reg_save_slot_indices()[sse_slot_index++];
 
-            mcode::Operand m_dst = mcode::Operand::from_stack_slot(slot_index, 8);
-            mcode::Operand m_src = mcode::Operand::from_register(mcode::Register::from_physical(reg), 8);
-            prolog.push_back(mcode::Instruction(X8664Opcode::MOVSD, {m_dst, m_src}));
+            mcode::Operand m_dst = mcode::Operand::from_stack_slot(slot_index, 16);
+            mcode::Operand m_src = mcode::Operand::from_register(mcode::Register::from_physical(reg), 16);
+            prolog.push_back(mcode::Instruction(X8664Opcode::MOVUPS, {m_dst, m_src}));
         }
     }
 
@@ -325,9 +328,9 @@ std::vector<mcode::Instruction> MSABICallingConv::get_epilog(mcode::Function *fu
         if (reg >= XMM0 && reg <= XMM15) {
             unsigned slot_index = func->get_stack_frame().get_reg_save_slot_indices()[sse_slot_index++];
 
-            mcode::Operand m_dst = mcode::Operand::from_register(mcode::Register::from_physical(reg), 8);
-            mcode::Operand m_src = mcode::Operand::from_stack_slot(slot_index, 8);
-            epilog.push_back(mcode::Instruction(X8664Opcode::MOVSD, {m_dst, m_src}));
+            mcode::Operand m_dst = mcode::Operand::from_register(mcode::Register::from_physical(reg), 16);
+            mcode::Operand m_src = mcode::Operand::from_stack_slot(slot_index, 16);
+            epilog.push_back(mcode::Instruction(X8664Opcode::MOVUPS, {m_dst, m_src}));
         }
     }
 
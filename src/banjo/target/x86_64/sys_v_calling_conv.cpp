@@ -46,7 +46,9 @@ void SysVCallingConv::lower_call(codegen::SSALowerer &lowerer, ssa::Instruction
         unsigned num_fp_args = 0;
 
         for (unsigned i = 1; i < instr.get_operands().size(); i++) {
-            if (instr.get_operand(i).get_type().is_floating_point()) {
+            ssa::Type type = instr.get_operand(i).get_type();
+
+            if (type.is_floating_point() || type.is_vector()) {
                 num_fp_args += 1;
             }
         }
@@ -88,7 +90,7 @@ void SysVCallingConv::append_call(ssa::Operand func_operand, codegen::SSALowerer
         m_callee = x86_64_lowerer.lower_as_operand(func_operand, {.is_callee = true});
     } else if (func_operand.is_register()) {
         ssa::InstrIter producer = lowerer.get_producer(func_operand.get_register());
-        if (producer->get_opcode() == ssa::Opcode::LOAD) {
+        if (producer != lowerer.get_block().end() && producer->get_opcode() == ssa::Opcode::LOAD) {
             codegen::SSALowerer::AddrComponents addr = lowerer.collect_addr(producer->get_operand(1));
             m_callee = x86_64_lowerer.lower_addr_mem_access(addr);
             lowerer.discard_use(func_operand.get_register());
@@ -103,7 +105,8 @@ void SysVCallingConv::append_call(ssa::Operand func_operand, codegen::SSALowerer
 void SysVCallingConv::append_ret_val_move(codegen::SSALowerer &lowerer) {
     ssa::Instruction &instr = *lowerer.get_instr_iter();
 
-    bool is_floating_point = instr.get_operand(0).get_type().is_floating_point();
+    ssa::Type return_type = instr.get_operand(0).get_type();
+    bool is_floating_point = return_type.is_floating_point() || return_type.is_vector();
     int return_size = lowerer.get_size(instr.get_operand(0).get_type());
 
     mcode::Opcode opcode;
@@ -117,6 +120,8 @@ void SysVCallingConv::append_ret_val_move(codegen::SSALowerer &lowerer) {
             opcode = X8664Opcode::MOVSS;
         } else if (return_size == 8) {
             opcode = X8664Opcode::MOVSD;
+        } else if (return_size == 16) {
+            opcode = X8664Opcode::MOVUPS;
         } else {
             ASSERT_UNREACHABLE;
         }
@@ -290,7 +295,7 @@ std::vector<mcode::ArgStorage> SysVCallingConv::get_arg_storage(const ssa::Funct
 
     for (unsigned i = 0; i < func_type.params.size(); i++) {
         mcode::ArgStorage &storage = result[i];
-        bool is_fp = func_type.params[i].is_floating_point();
+        bool is_fp = func_type.params[i].is_floating_point() || func_type.params[i].is_vector();
 
         if (is_fp && float_reg_index < ARG_REGS_FLOAT.size()) {
             storage.in_reg = true;
@@ -6,6 +6,7 @@
 #include "banjo/target/x86_64/x86_64_opcode.hpp"
 #include "banjo/target/x86_64/x86_64_ssa_lowerer.hpp"
 #include "banjo/utils/macros.hpp"
+#include "banjo/utils/utils.hpp"
 
 namespace banjo {
 
@@ -42,17 +43,28 @@ mcode::Operand X8664ConstLowering::load_f32(float value) {
 }
 
 mcode::Operand X8664ConstLowering::load_f64(double value) {
-    mcode::Global global{
-        .name = "float." + std::to_string(cur_id++),
-        .size = 8,
-        .alignment = 8,
-        .value = value,
-    };
+    std::uint64_t bits = utils::get_bits_64(value);
+    std::string float_label;
+    auto const_f64_iter = const_f64s.find(bits);
 
-    lowerer.get_machine_module().add(global);
+    if (const_f64_iter != const_f64s.end()) {
+        float_label = const_f64_iter->second;
+    } else {
+        float_label = "float.f64." + utils::to_hex_string(bits, 16);
+
+        mcode::Global global{
+            .name = float_label,
+            .size = 8,
+            .alignment = 8,
+            .value = value,
+        };
+
+        lowerer.get_machine_module().add(global);
+        const_f64s.insert({bits, float_label});
+    }
 
-    X8664Address m_addr{mcode::Symbol{global.name, mcode::Relocation::NONE}};
-    return mcode::Operand::from_x86_64_addr(m_addr, global.size);
+    X8664Address m_addr{mcode::Symbol{float_label, mcode::Relocation::NONE}};
+    return mcode::Operand::from_x86_64_addr(m_addr, 8);
 }
 
 void X8664ConstLowering::process_block() {
@@ -73,13 +85,14 @@ void X8664ConstLowering::process_block() {
                 return;
             }
 
+            std::uint32_t bits = utils::get_bits_32(val);
             std::string float_label;
-            auto const_f32_iter = const_f32s.find(val);
+            auto const_f32_iter = const_f32s.find(bits);
 
             if (const_f32_iter != const_f32s.end()) {
                 float_label = const_f32_iter->second;
             } else {
-                float_label = "float." + std::to_string(cur_id++);
+                float_label = "float.f32." + utils::to_hex_string(bits, 8);
 
                 mcode::Global global{
                     .name = float_label,
@@ -89,7 +102,7 @@ void X8664ConstLowering::process_block() {
                 };
 
                 lowerer.get_machine_module().add(global);
-                const_f32s.insert({val, float_label});
+                const_f32s.insert({bits, float_label});
             }
 
             ConstStorage storage;
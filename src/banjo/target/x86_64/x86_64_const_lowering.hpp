@@ -6,6 +6,7 @@
 #include "banjo/ssa/basic_block.hpp"
 #include "banjo/ssa/instruction.hpp"
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -33,8 +34,10 @@ private:
 
     X8664SSALowerer &lowerer;
 
-    unsigned cur_id = 0;
-    std::map<float, std::string> const_f32s;
+    // Constants are named after their bit pattern so that labels don't depend on the order in
+    // which functions are lowered.
+    std::map<std::uint32_t, std::string> const_f32s;
+    std::map<std::uint64_t, std::string> const_f64s;
 
     std::unordered_map<ssa::InstrIter, std::map<float, ConstStorage>> f32_storage;
     ssa::BasicBlockIter last_block = nullptr;
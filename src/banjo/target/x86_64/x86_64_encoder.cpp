@@ -90,6 +90,26 @@ void X8664Encoder::encode_instr(mcode::Instruction &instr, mcode::Function *func
         case CVTSI2SD: encode_cvtsi2sd(instr, func); break;
         case CVTSS2SI: encode_cvtss2si(instr, func); break;
         case CVTSD2SI: encode_cvtsd2si(instr, func); break;
+        case MOVD: encode_movd(instr); break;
+        case ADDPS: encode_sse_packed_op(instr, func, 0x00, 0x58); break;
+        case ADDPD: encode_sse_packed_op(instr, func, 0x66, 0x58); break;
+        case SUBPS: encode_sse_packed_op(instr, func, 0x00, 0x5C); break;
+        case SUBPD: encode_sse_packed_op(instr, func, 0x66, 0x5C); break;
+        case MULPS: encode_sse_packed_op(instr, func, 0x00, 0x59); break;
+        case MULPD: encode_sse_packed_op(instr, func, 0x66, 0x59); break;
+        case DIVPS: encode_sse_packed_op(instr, func, 0x00, 0x5E); break;
+        case DIVPD: encode_sse_packed_op(instr, func, 0x66, 0x5E); break;
+        case PADDD: encode_sse_packed_op(instr, func, 0x66, 0xFE); break;
+        case PSUBD: encode_sse_packed_op(instr, func, 0x66, 0xFA); break;
+        case PMULLD: encode_pmulld(instr, func); break;
+        case SHUFPS: encode_sse_packed_op(instr, func, 0x00, 0xC6); break;
+        case SHUFPD: encode_sse_packed_op(instr, func, 0x66, 0xC6); break;
+        case PSHUFD: encode_sse_packed_op(instr, func, 0x66, 0x70); break;
+        case CMPPS: encode_sse_packed_op(instr, func, 0x00, 0xC2); break;
+        case CMPPD: encode_sse_packed_op(instr, func, 0x66, 0xC2); break;
+        case PCMPEQD: encode_sse_packed_op(instr, func, 0x66, 0x76); break;
+        case MOVMSKPS: encode_sse_packed_op(instr, func, 0x00, 0x50); break;
+        case MOVMSKPD: encode_sse_packed_op(instr, func, 0x66, 0x50); break;
         case EH_PUSHREG: process_eh_pushreg(instr, frame_info); break;
         default: ASSERT_UNREACHABLE;
     }
@@ -486,6 +506,40 @@ void X8664Encoder::encode_movq(mcode::Instruction &instr) {
     }
 }
 
+void X8664Encoder::encode_movd(mcode::Instruction &instr) {
+    mcode::Operand &dst = instr.get_operand(0);
+    mcode::Operand &src = instr.get_operand(1);
+
+    // Only the general-purpose to SSE register variant is used by the lowerer.
+    ASSERT(is_reg(dst) && is_reg(src));
+
+    RegCode dst_reg = reg(dst);
+    RegCode src_reg = reg(src);
+
+    emit_opcode(0x66);
+    emit_rex_rr(0, dst_reg, src_reg);
+    emit_opcode(0x0F);
+    emit_opcode(0x6E);
+    emit_modrm_rr(dst_reg, src_reg);
+}
+
+void X8664Encoder::encode_pmulld(mcode::Instruction &instr, mcode::Function *func) {
+    mcode::Operand &dst = instr.get_operand(0);
+    mcode::Operand &src = instr.get_operand(1);
+
+    ASSERT_MESSAGE(is_reg(dst), "SSE instructions can only operate on registers");
+
+    RegCode dst_reg = reg(dst);
+    RegOrAddr src_roa = roa(src, func);
+
+    emit_opcode(0x66);
+    emit_rex_rroa(0, dst_reg, src_roa);
+    emit_opcode(0x0F);
+    emit_opcode(0x38);
+    emit_opcode(0x40);
+    emit_modrm_sib(dst_reg, src_roa);
+}
+
 void X8664Encoder::encode_addss(mcode::Instruction &instr, mcode::Function *func) {
     encode_sse_op(instr, func, 0xF3, 0x58);
 }
@@ -727,6 +781,38 @@ void X8664Encoder::encode_sse_op(
     emit_sse(prefix, opcode, reg(dst), roa(src, func), 0);
 }
 
+void X8664Encoder::encode_sse_packed_op(
+    mcode::Instruction &instr,
+    mcode::Function *func,
+    std::uint8_t prefix,
+    std::uint8_t opcode
+) {
+    mcode::Operand &dst = instr.get_operand(0);
+    mcode::Operand &src = instr.get_operand(1);
+
+    ASSERT_MESSAGE(is_reg(dst), "SSE instructions can only operate on registers");
+
+    RegCode dst_reg = reg(dst);
+    RegOrAddr src_roa = roa(src, func);
+
+    // Packed single-precision instructions don't have a mandatory prefix.
+    if (prefix != 0x00) {
+        emit_opcode(prefix);
+    }
+
+    emit_rex_rroa(0, dst_reg, src_roa);
+    emit_opcode(0x0F);
+    emit_opcode(opcode);
+    emit_modrm_sib(dst_reg, src_roa);
+
+    // Shuffles and comparisons take an additional 8-bit immediate. The displacement of RIP-relative addresses
+    // would have to account for it, so the source has to be a register in that case.
+    if (instr.get_operands().size() == 3) {
+        ASSERT(is_reg(src));
+        text.write_u8(static_cast<std::uint8_t>(instr.get_operand(2).get_int_immediate().to_u64()));
+    }
+}
+
 void X8664Encoder::encode_sse_cvt(
     mcode::Instruction &instr,
     mcode::Function *func,
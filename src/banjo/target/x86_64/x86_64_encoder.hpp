@@ -179,6 +179,8 @@ private:
     void encode_cvtsi2sd(mcode::Instruction &instr, mcode::Function *func);
     void encode_cvtss2si(mcode::Instruction &instr, mcode::Function *func);
     void encode_cvtsd2si(mcode::Instruction &instr, mcode::Function *func);
+    void encode_movd(mcode::Instruction &instr);
+    void encode_pmulld(mcode::Instruction &instr, mcode::Function *func);
 
     void encode_basic_instr(mcode::Instruction &instr, mcode::Function *func, const BasicInstrOpcodes &opcodes);
 
@@ -188,6 +190,13 @@ private:
 
     void encode_sse_op(mcode::Instruction &instr, mcode::Function *func, std::uint8_t prefix, std::uint8_t opcode);
 
+    void encode_sse_packed_op(
+        mcode::Instruction &instr,
+        mcode::Function *func,
+        std::uint8_t prefix,
+        std::uint8_t opcode
+    );
+
     void encode_sse_cvt(
         mcode::Instruction &instr,
         mcode::Function *func,
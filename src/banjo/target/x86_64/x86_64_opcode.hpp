@@ -100,7 +100,26 @@ enum {
     CVTSI2SS,
     CVTSI2SD,
     CVTSS2SI,
-    CVTSD2SI
+    CVTSD2SI,
+    ADDPS,
+    ADDPD,
+    SUBPS,
+    SUBPD,
+    MULPS,
+    MULPD,
+    DIVPS,
+    DIVPD,
+    PADDD,
+    PSUBD,
+    PMULLD,
+    SHUFPS,
+    SHUFPD,
+    PSHUFD,
+    CMPPS,
+    CMPPD,
+    PCMPEQD,
+    MOVMSKPS,
+    MOVMSKPD
 };
 
 } // namespace X8664Opcode
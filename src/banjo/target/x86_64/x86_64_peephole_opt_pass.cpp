@@ -24,16 +24,10 @@ const std::unordered_set<mcode::Opcode> STACK_LOADING_OPS = {
     X8664Opcode::DIVSD,
 };
 
-void X8664PeepholeOptPass::run(mcode::Module &module_) {
-    for (mcode::Function *func : module_.get_functions()) {
-        run(func);
-    }
-}
-
-void X8664PeepholeOptPass::run(mcode::Function *func) {
+void X8664PeepholeOptPass::run(mcode::Function &func) {
     PROFILE_SCOPE("x86-64 peephole opt");
 
-    for (mcode::BasicBlock &basic_block : func->get_basic_blocks()) {
+    for (mcode::BasicBlock &basic_block : func.get_basic_blocks()) {
         for (mcode::Instruction &instr : basic_block) {
             if (instr.get_opcode() == X8664Opcode::MOVSS && instr.get_operand(0).is_register() &&
                 instr.get_operand(1).is_register()) {
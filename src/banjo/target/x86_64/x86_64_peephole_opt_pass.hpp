@@ -10,8 +10,7 @@ namespace target {
 class X8664PeepholeOptPass : public codegen::MachinePass {
 
 public:
-    void run(mcode::Module &module_);
-    void run(mcode::Function *func);
+    void run(mcode::Function &func) override;
 };
 
 } // namespace target
@@ -154,6 +154,9 @@ std::vector<mcode::RegOp> X8664RegAnalyzer::get_operands(mcode::InstrIter iter,
         case CVTSI2SD:
         case CVTSS2SI:
         case CVTSD2SI:
+        case PSHUFD:
+        case MOVMSKPS:
+        case MOVMSKPD:
             collect_regs(instr.get_operand(0), mcode::RegUsage::DEF, operands);
             collect_regs(instr.get_operand(1), mcode::RegUsage::USE, operands);
             break;
@@ -201,6 +204,22 @@ std::vector<mcode::RegOp> X8664RegAnalyzer::get_operands(mcode::InstrIter iter,
         case MAXSD:
         case SQRTSS:
         case SQRTSD:
+        case ADDPS:
+        case ADDPD:
+        case SUBPS:
+        case SUBPD:
+        case MULPS:
+        case MULPD:
+        case DIVPS:
+        case DIVPD:
+        case PADDD:
+        case PSUBD:
+        case PMULLD:
+        case SHUFPS:
+        case SHUFPD:
+        case CMPPS:
+        case CMPPD:
+        case PCMPEQD:
             collect_regs(instr.get_operand(0), mcode::RegUsage::USE_DEF, operands);
             collect_regs(instr.get_operand(1), mcode::RegUsage::USE, operands);
             break;
@@ -258,8 +277,8 @@ void X8664RegAnalyzer::assign_reg_classes(mcode::Instruction &instr, codegen::Re
     mcode::Opcode opcode = instr.get_opcode();
     ssa::VirtualRegister reg = instr.get_operand(0).get_virtual_reg();
 
-    if ((opcode >= MOVSS && opcode <= MOVUPS) || (opcode >= ADDSS && opcode <= UCOMISD) || opcode == CVTSS2SD ||
-        opcode == CVTSD2SS || opcode == CVTSI2SS || opcode == CVTSI2SD) {
+    if ((opcode >= MOVSS && opcode <= MOVD) || (opcode >= ADDSS && opcode <= UCOMISD) || opcode == CVTSS2SD ||
+        opcode == CVTSD2SS || opcode == CVTSI2SS || opcode == CVTSI2SD || (opcode >= ADDPS && opcode <= PCMPEQD)) {
         reg_classes.insert({reg, X8664RegClass::SSE});
     } else {
         reg_classes.insert({reg, X8664RegClass::GENERAL_PURPOSE});
@@ -283,7 +302,7 @@ void X8664RegAnalyzer::insert_load(SpilledRegUse use) {
     mcode::Operand src = mcode::Operand::from_stack_slot(use.stack_slot, size);
     mcode::Operand dst = mcode::Operand::from_register(mcode::Register::from_physical(use.reg), size);
 
-    if (is_memory_operand_allowed(*use.instr_iter)) {
+    if (use.allow_folding && is_memory_operand_allowed(*use.instr_iter, 1, use.reg)) {
         use.instr_iter->get_operand(1) = src;
         return;
     }
@@ -297,7 +316,7 @@ void X8664RegAnalyzer::insert_store(SpilledRegUse use) {
     mcode::Operand src = mcode::Operand::from_register(mcode::Register::from_physical(use.reg), size);
     mcode::Operand dst = mcode::Operand::from_stack_slot(use.stack_slot, size);
 
-    if (is_memory_operand_allowed(*use.instr_iter)) {
+    if (use.allow_folding && is_memory_operand_allowed(*use.instr_iter, 0, use.reg)) {
         use.instr_iter->get_operand(0) = dst;
         return;
     }
@@ -321,7 +340,11 @@ bool X8664RegAnalyzer::is_move_opcode(mcode::Opcode opcode) {
     return opcode == MOV || (opcode >= MOVSS && opcode <= MOVUPS);
 }
 
-bool X8664RegAnalyzer::is_memory_operand_allowed(mcode::Instruction &instr) {
+bool X8664RegAnalyzer::is_memory_operand_allowed(
+    mcode::Instruction &instr,
+    unsigned operand_index,
+    mcode::PhysicalReg reg
+) {
     mcode::Operand &dst = instr.get_operand(0);
     mcode::Operand &src = instr.get_operand(1);
 
@@ -329,10 +352,18 @@ bool X8664RegAnalyzer::is_memory_operand_allowed(mcode::Instruction &instr) {
         return false;
     }
 
+    // Only the operand holding the spilled register can be replaced with the stack slot.
+    mcode::Register spilled_reg = mcode::Register::from_physical(reg);
+    mcode::Operand &other = operand_index == 0 ? src : dst;
+
+    if (instr.get_operand(operand_index).get_register() != spilled_reg || other.get_register() == spilled_reg) {
+        return false;
+    }
+
     switch (instr.get_opcode()) {
         case X8664Opcode::MOV:
-        case X8664Opcode::MOVSS:
-        case X8664Opcode::ADD: return true;
+        case X8664Opcode::MOVSS: return true;
+        case X8664Opcode::ADD: return operand_index == 1; // the destination is also read
         default: return false;
     }
 }
@@ -341,7 +372,9 @@ mcode::Opcode X8664RegAnalyzer::get_move_opcode(codegen::RegClass reg_class, uns
     if (reg_class == X8664RegClass::GENERAL_PURPOSE) {
         return target::X8664Opcode::MOV;
     } else if (reg_class == X8664RegClass::SSE) {
-        return size == 4 ? X8664Opcode::MOVSS : X8664Opcode::MOVSD;
+        if (size == 4) return X8664Opcode::MOVSS;
+        else if (size == 8) return X8664Opcode::MOVSD;
+        else return X8664Opcode::MOVUPS;
     } else {
         ASSERT_UNREACHABLE;
     }
@@ -45,7 +45,7 @@ public:
 
 private:
     bool is_move_opcode(mcode::Opcode opcode);
-    bool is_memory_operand_allowed(mcode::Instruction &instr);
+    bool is_memory_operand_allowed(mcode::Instruction &instr, unsigned operand_index, mcode::PhysicalReg reg);
     mcode::Opcode get_move_opcode(codegen::RegClass reg_class, unsigned size);
 
     void collect_regs(mcode::Operand &operand, mcode::RegUsage usage, std::vector<mcode::RegOp> &dst);
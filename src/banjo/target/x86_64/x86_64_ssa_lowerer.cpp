@@ -67,8 +67,12 @@ void X8664SSALowerer::append_mov_and_operation(
     unsigned size = get_size(lhs.get_type());
     mcode::Operand m_dst = map_vreg_as_operand(dst, size);
 
+    // Legacy SSE instructions fault on unaligned 16-byte memory operands, so packed operations always
+    // read their operands from registers.
+    bool allow_addrs = m_dst.is_register() && !lhs.get_type().is_vector();
+
     lower_as_move(m_dst, lhs);
-    mcode::Operand m_rhs = lower_as_operand(rhs, {.allow_addrs = m_dst.is_register()});
+    mcode::Operand m_rhs = lower_as_operand(rhs, {.allow_addrs = allow_addrs});
     emit(mcode::Instruction(machine_opcode, {m_dst, m_rhs}));
 }
 
@@ -163,7 +167,8 @@ void X8664SSALowerer::emit_block_prologue(ssa::BasicBlock &block) {
 
         ssa::VirtualRegister tmp_reg = block_arg_tmps.at(arg_reg);
         mcode::Opcode opcode = get_move_opcode(type);
-        unsigned reg_size = get_size(type) == 8 ? 8 : 4;
+        unsigned size = get_size(type);
+        unsigned reg_size = size == 8 || size == 16 ? size : 4;
 
         mcode::Operand dst = mcode::Operand::from_register(mcode::Register::from_virtual(arg_reg), reg_size);
         mcode::Operand src = mcode::Operand::from_register(mcode::Register::from_virtual(tmp_reg), reg_size);
@@ -345,6 +350,11 @@ void X8664SSALowerer::lower_add(ssa::Instruction &instr) {
     ssa::Operand rhs = instr.get_operand(1);
     // int size = get_size(lhs.get_type());
 
+    if (lhs.get_type().is_vector()) {
+        append_mov_and_operation(X8664Opcode::PADDD, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
+        return;
+    }
+
     // Try to use a LEA dst, [lhs + rhs] instruction.
     /*
     if(lhs.is_register() && rhs.is_register()) {
@@ -365,6 +375,11 @@ void X8664SSALowerer::lower_add(ssa::Instruction &instr) {
 }
 
 void X8664SSALowerer::lower_sub(ssa::Instruction &instr) {
+    if (instr.get_operand(0).get_type().is_vector()) {
+        append_mov_and_operation(X8664Opcode::PSUBD, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
+        return;
+    }
+
     append_mov_and_operation(X8664Opcode::SUB, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
 }
 
@@ -372,6 +387,11 @@ void X8664SSALowerer::lower_mul(ssa::Instruction &instr) {
     ssa::Operand &lhs = instr.get_operand(0);
     ssa::Operand &rhs = instr.get_operand(1);
 
+    if (lhs.get_type().is_vector()) {
+        append_mov_and_operation(X8664Opcode::PMULLD, *instr.get_dest(), lhs, rhs);
+        return;
+    }
+
     if (lhs.is_register() && rhs.is_immediate()) {
         unsigned size = get_size(lhs.get_type());
 
@@ -413,7 +433,8 @@ void X8664SSALowerer::lower_urem(ssa::Instruction &instr) {
 
 void X8664SSALowerer::lower_fadd(ssa::Instruction &instr) {
     ssa::Primitive type = instr.get_operand(0).get_type().get_primitive();
-    mcode::Opcode opcode = type == ssa::Primitive::F64 ? X8664Opcode::ADDSD : X8664Opcode::ADDSS;
+    mcode::Opcode opcode =
+        get_fp_opcode(type, X8664Opcode::ADDSS, X8664Opcode::ADDSD, X8664Opcode::ADDPS, X8664Opcode::ADDPD);
     append_mov_and_operation(opcode, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
 }
 
@@ -438,19 +459,22 @@ void X8664SSALowerer::lower_fsub(ssa::Instruction &instr) {
         return;
     }
 
-    mcode::Opcode opcode = type == ssa::Primitive::F64 ? X8664Opcode::SUBSD : X8664Opcode::SUBSS;
+    mcode::Opcode opcode =
+        get_fp_opcode(type, X8664Opcode::SUBSS, X8664Opcode::SUBSD, X8664Opcode::SUBPS, X8664Opcode::SUBPD);
     append_mov_and_operation(opcode, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
 }
 
 void X8664SSALowerer::lower_fmul(ssa::Instruction &instr) {
     ssa::Primitive type = instr.get_operand(0).get_type().get_primitive();
-    mcode::Opcode opcode = type == ssa::Primitive::F64 ? X8664Opcode::MULSD : X8664Opcode::MULSS;
+    mcode::Opcode opcode =
+        get_fp_opcode(type, X8664Opcode::MULSS, X8664Opcode::MULSD, X8664Opcode::MULPS, X8664Opcode::MULPD);
     append_mov_and_operation(opcode, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
 }
 
 void X8664SSALowerer::lower_fdiv(ssa::Instruction &instr) {
     ssa::Primitive type = instr.get_operand(0).get_type().get_primitive();
-    mcode::Opcode opcode = type == ssa::Primitive::F64 ? X8664Opcode::DIVSD : X8664Opcode::DIVSS;
+    mcode::Opcode opcode =
+        get_fp_opcode(type, X8664Opcode::DIVSS, X8664Opcode::DIVSD, X8664Opcode::DIVPS, X8664Opcode::DIVPD);
     append_mov_and_operation(opcode, *instr.get_dest(), instr.get_operand(0), instr.get_operand(1));
 }
 
@@ -551,7 +575,8 @@ void X8664SSALowerer::lower_ret(ssa::Instruction &instr) {
         ssa::Type type = instr.get_operand(0).get_type();
 
         mcode::Opcode opcode = get_move_opcode(type);
-        long dest_reg = type.is_floating_point() ? X8664Register::XMM0 : X8664Register::RAX;
+        bool is_sse = type.is_floating_point() || type.is_vector();
+        long dest_reg = is_sse ? X8664Register::XMM0 : X8664Register::RAX;
 
         emit(
             mcode::Instruction(
@@ -682,11 +707,33 @@ void X8664SSALowerer::lower_sqrt(ssa::Instruction &instr) {
     emit(mcode::Instruction(opcode, {m_dst, m_src}));
 }
 
+void X8664SSALowerer::lower_splat(ssa::Instruction &instr) {
+    ssa::Operand &scalar = instr.get_operand(0);
+    ssa::Type type = instr.get_operand(1).get_type();
+
+    mcode::Operand m_dst = map_vreg_dst(instr, 16);
+    mcode::Operand m_shuffle_mask = mcode::Operand::from_int_immediate(0, 1);
+
+    // Move the scalar into the lowest lane and broadcast it to the other lanes using a shuffle.
+    if (type.is_primitive(ssa::Primitive::I32X4)) {
+        mcode::Operand m_tmp = mcode::Operand::from_register(create_reg(), 4);
+        lower_as_move(m_tmp, scalar);
+        emit({X8664Opcode::MOVD, {m_dst, m_tmp}});
+        emit({X8664Opcode::PSHUFD, {m_dst, m_dst, m_shuffle_mask}});
+    } else {
+        lower_as_move(m_dst.with_size(get_size(scalar.get_type())), scalar);
+
+        mcode::Opcode opcode = type.is_primitive(ssa::Primitive::F32X4) ? X8664Opcode::SHUFPS : X8664Opcode::SHUFPD;
+        emit({opcode, {m_dst, m_dst, m_shuffle_mask}});
+    }
+}
+
 mcode::Operand X8664SSALowerer::into_reg_or_addr(ssa::Operand &operand) {
     if (operand.is_register()) {
         ssa::InstrIter producer = get_producer(operand.get_register());
 
-        if (producer->get_opcode() == ssa::Opcode::LOAD && get_num_uses(*producer->get_dest()) == 1) {
+        if (producer != get_block().end() && producer->get_opcode() == ssa::Opcode::LOAD &&
+            get_num_uses(*producer->get_dest()) == 1) {
             discard_use(*producer->get_dest());
             AddrComponents addr = collect_addr(producer->get_operand(1));
             return lower_addr_mem_access(addr);
@@ -713,9 +760,25 @@ mcode::Operand X8664SSALowerer::read_symbol_addr(const mcode::Symbol &symbol) {
 mcode::Opcode X8664SSALowerer::get_move_opcode(ssa::Type type) {
     if (type.is_primitive(ssa::Primitive::F32)) return X8664Opcode::MOVSS;
     else if (type.is_primitive(ssa::Primitive::F64)) return X8664Opcode::MOVSD;
+    else if (type.is_vector()) return X8664Opcode::MOVUPS;
     else return X8664Opcode::MOV;
 }
 
+mcode::Opcode X8664SSALowerer::get_fp_opcode(
+    ssa::Primitive type,
+    mcode::Opcode f32_opcode,
+    mcode::Opcode f64_opcode,
+    mcode::Opcode f32x4_opcode,
+    mcode::Opcode f64x2_opcode
+) {
+    switch (type) {
+        case ssa::Primitive::F64: return f64_opcode;
+        case ssa::Primitive::F32X4: return f32x4_opcode;
+        case ssa::Primitive::F64X2: return f64x2_opcode;
+        default: return f32_opcode;
+    }
+}
+
 mcode::CallingConvention *X8664SSALowerer::get_calling_convention(ssa::CallingConv calling_conv) {
     switch (calling_conv) {
         case ssa::CallingConv::X86_64_SYS_V_ABI: return (mcode::CallingConvention *)&SysVCallingConv::INSTANCE;
@@ -895,7 +958,7 @@ void X8664SSALowerer::lower_cond_branch(mcode::Opcode cmp_opcode, ssa::Instructi
         mcode::Opcode branch_opcode = X8664Opcode::JCC + static_cast<unsigned>(condition);
 
         move_branch_args(target_false);
-        append_mov_and_operation(cmp_opcode, get_func().next_virtual_reg(), lhs, rhs);
+        lower_compare(cmp_opcode, lhs, rhs);
         emit({branch_opcode, {m_target_false}});
         move_branch_args(target_true);
     } else {
@@ -903,7 +966,7 @@ void X8664SSALowerer::lower_cond_branch(mcode::Opcode cmp_opcode, ssa::Instructi
         mcode::Opcode branch_opcode = X8664Opcode::JCC + static_cast<unsigned>(condition);
 
         move_branch_args(target_true);
-        append_mov_and_operation(cmp_opcode, get_func().next_virtual_reg(), lhs, rhs);
+        lower_compare(cmp_opcode, lhs, rhs);
         emit({branch_opcode, {m_target_true}});
         move_branch_args(target_false);
 
@@ -913,6 +976,43 @@ void X8664SSALowerer::lower_cond_branch(mcode::Opcode cmp_opcode, ssa::Instructi
     }
 }
 
+void X8664SSALowerer::lower_compare(mcode::Opcode cmp_opcode, ssa::Value &lhs, ssa::Value &rhs) {
+    if (lhs.get_type().is_vector()) {
+        lower_vector_compare(lhs, rhs);
+    } else {
+        append_mov_and_operation(cmp_opcode, get_func().next_virtual_reg(), lhs, rhs);
+    }
+}
+
+void X8664SSALowerer::lower_vector_compare(ssa::Value &lhs, ssa::Value &rhs) {
+    ssa::Primitive type = lhs.get_type().get_primitive();
+
+    // Compare the vectors lane by lane, collect the lane masks in a general-purpose register and check
+    // whether all of them are set. The flags then hold the result of an equality comparison.
+    mcode::Operand m_lanes = mcode::Operand::from_register(create_reg(), 16);
+    mcode::Operand m_mask = mcode::Operand::from_register(create_reg(), 4);
+    mcode::Operand m_equal_mask;
+
+    lower_as_move(m_lanes, lhs);
+    mcode::Operand m_rhs = lower_as_operand(rhs);
+
+    if (type == ssa::Primitive::F32X4) {
+        emit({X8664Opcode::CMPPS, {m_lanes, m_rhs, mcode::Operand::from_int_immediate(0, 1)}});
+        emit({X8664Opcode::MOVMSKPS, {m_mask, m_lanes}});
+        m_equal_mask = mcode::Operand::from_int_immediate(0b1111, 4);
+    } else if (type == ssa::Primitive::F64X2) {
+        emit({X8664Opcode::CMPPD, {m_lanes, m_rhs, mcode::Operand::from_int_immediate(0, 1)}});
+        emit({X8664Opcode::MOVMSKPD, {m_mask, m_lanes}});
+        m_equal_mask = mcode::Operand::from_int_immediate(0b11, 4);
+    } else {
+        emit({X8664Opcode::PCMPEQD, {m_lanes, m_rhs}});
+        emit({X8664Opcode::MOVMSKPS, {m_mask, m_lanes}});
+        m_equal_mask = mcode::Operand::from_int_immediate(0b1111, 4);
+    }
+
+    emit({X8664Opcode::CMP, {m_mask, m_equal_mask}});
+}
+
 X8664Condition X8664SSALowerer::lower_condition(ssa::Comparison comparison) {
     switch (comparison) {
         case ssa::Comparison::EQ: return X8664Condition::E;
@@ -943,7 +1043,9 @@ void X8664SSALowerer::move_branch_args(ssa::BranchTarget &target) {
         unsigned size = get_size(arg.get_type());
         mcode::Operand dst = mcode::Operand::from_register(mcode::Register::from_virtual(tmp_reg), size);
 
-        if (arg.is_int_immediate() && arg.get_int_immediate() == 0) {
+        if (arg.get_type().is_vector() && arg.is_immediate()) {
+            emit({X8664Opcode::XORPS, {dst, dst}, mcode::Instruction::FLAG_CALL_ARG});
+        } else if (arg.is_int_immediate() && arg.get_int_immediate() == 0) {
             emit({X8664Opcode::XOR, {dst, dst}, mcode::Instruction::FLAG_CALL_ARG});
         } else if (arg.is_fp_immediate() && arg.get_fp_immediate() == 0.0) {
             emit({X8664Opcode::XORPS, {dst, dst}, mcode::Instruction::FLAG_CALL_ARG});
@@ -962,7 +1064,9 @@ mcode::Operand X8664SSALowerer::lower_as_move_into_reg(mcode::Register reg, cons
 }
 
 mcode::Operand X8664SSALowerer::lower_as_move(mcode::Operand m_dst, const ssa::Value &value) {
-    if (value.is_int_immediate()) {
+    if (value.get_type().is_vector() && value.is_immediate()) {
+        return lower_vector_imm_as_move(m_dst, value);
+    } else if (value.is_int_immediate()) {
         return lower_int_imm_as_move(m_dst, value.get_int_immediate());
     } else if (value.is_fp_immediate()) {
         return lower_fp_imm_as_move(m_dst, value.get_fp_immediate());
@@ -1024,6 +1128,22 @@ mcode::Operand X8664SSALowerer::lower_fp_imm_as_move(mcode::Operand m_dst, doubl
     return m_dst;
 }
 
+mcode::Operand X8664SSALowerer::lower_vector_imm_as_move(mcode::Operand m_dst, const ssa::Value &value) {
+    // Vector immediates only come from undefined values, which are materialized as zero.
+    ASSERT((value.is_int_immediate() && value.get_int_immediate() == 0) ||
+           (value.is_fp_immediate() && value.get_fp_immediate() == 0.0));
+
+    if (m_dst.is_register()) {
+        emit({X8664Opcode::XORPS, {m_dst, m_dst}});
+    } else {
+        mcode::Operand m_tmp = mcode::Operand::from_register(create_reg(), 16);
+        emit({X8664Opcode::XORPS, {m_tmp, m_tmp}});
+        emit({X8664Opcode::MOVUPS, {m_dst, m_tmp}});
+    }
+
+    return m_dst;
+}
+
 mcode::Operand X8664SSALowerer::lower_reg_as_move(mcode::Operand m_dst, ssa::VirtualRegister src_reg, ssa::Type type) {
     mcode::Operand m_src = map_vreg_as_operand(src_reg, m_dst.get_size());
 
@@ -1038,6 +1158,8 @@ mcode::Operand X8664SSALowerer::lower_reg_as_move(mcode::Operand m_dst, ssa::Vir
     } else if (type.is_floating_point()) {
         mcode::Opcode m_opcode = m_dst.get_size() == 4 ? X8664Opcode::MOVSS : X8664Opcode::MOVSD;
         emit({m_opcode, {m_dst, m_src}});
+    } else if (type.is_vector()) {
+        emit({X8664Opcode::MOVUPS, {m_dst, m_src}});
     } else {
         emit({X8664Opcode::MOV, {m_dst, m_src}});
     }
@@ -1052,7 +1174,10 @@ mcode::Operand X8664SSALowerer::lower_as_operand(const ssa::Value &value) {
 mcode::Operand X8664SSALowerer::lower_as_operand(const ssa::Value &value, ValueLowerFlags flags) {
     unsigned size = get_size(value.get_type());
 
-    if (value.is_int_immediate()) {
+    if (value.get_type().is_vector() && value.is_immediate()) {
+        mcode::Operand m_dst = mcode::Operand::from_register(create_reg(), size);
+        return lower_vector_imm_as_move(m_dst, value);
+    } else if (value.is_int_immediate()) {
         return lower_int_imm_as_operand(value.get_int_immediate(), size);
     } else if (value.is_fp_immediate()) {
         return lower_fp_imm_as_operand(value.get_fp_immediate(), size);
@@ -1116,7 +1241,8 @@ mcode::Operand X8664SSALowerer::lower_reg_as_operand(
 
         // If this register was produced by a load, use the loaded value directly instead of first
         // loading it into a register.
-        if (producer->get_opcode() == ssa::Opcode::LOAD && get_num_uses(*producer->get_dest()) == 1) {
+        if (producer != get_block().end() && producer->get_opcode() == ssa::Opcode::LOAD &&
+            get_num_uses(*producer->get_dest()) == 1) {
             AddrComponents addr = collect_addr(producer->get_operand(1));
             mcode::Operand m_load_dst = lower_addr_mem_access(addr);
             discard_use(*producer->get_dest());
@@ -89,8 +89,16 @@ public:
     void lower_memberptr(ssa::Instruction &instr) override;
     void lower_copy(ssa::Instruction &instr) override;
     void lower_sqrt(ssa::Instruction &instr) override;
+    void lower_splat(ssa::Instruction &instr) override;
 
     mcode::Opcode get_move_opcode(ssa::Type type);
+    mcode::Opcode get_fp_opcode(
+        ssa::Primitive type,
+        mcode::Opcode f32_opcode,
+        mcode::Opcode f64_opcode,
+        mcode::Opcode f32x4_opcode,
+        mcode::Opcode f64x2_opcode
+    );
     void copy_block_using_movs(ssa::Instruction &instr, unsigned size);
     mcode::Opcode get_cmovcc_opcode(ssa::Comparison comparison);
 
@@ -101,6 +109,8 @@ public:
     void lower_into_idiv(mcode::PhysicalReg result, ssa::Instruction &instr);
     void lower_shift(mcode::Opcode opcode, ssa::Instruction &instr);
     void lower_cond_branch(mcode::Opcode cmp_opcode, ssa::Instruction &instr);
+    void lower_compare(mcode::Opcode cmp_opcode, ssa::Value &lhs, ssa::Value &rhs);
+    void lower_vector_compare(ssa::Value &lhs, ssa::Value &rhs);
 
     X8664Condition lower_condition(ssa::Comparison comparison);
     void move_branch_args(ssa::BranchTarget &target);
@@ -109,6 +119,7 @@ public:
     mcode::Operand lower_as_move(mcode::Operand m_dst, const ssa::Value &value);
     mcode::Operand lower_int_imm_as_move(mcode::Operand m_dst, LargeInt value);
     mcode::Operand lower_fp_imm_as_move(mcode::Operand m_dst, double value);
+    mcode::Operand lower_vector_imm_as_move(mcode::Operand m_dst, const ssa::Value &value);
     mcode::Operand lower_reg_as_move(mcode::Operand m_dst, ssa::VirtualRegister src_reg, ssa::Type type);
 
     mcode::Operand lower_as_operand(const ssa::Value &value);
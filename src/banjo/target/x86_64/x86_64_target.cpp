@@ -21,6 +21,7 @@ X8664Target::X8664Target(TargetDescription descr, CodeModel code_model)
         .usize_type = ssa::Primitive::U64,
         .max_regs_per_arg = descr.is_windows() ? 1u : 2u,
         .supports_structs_in_regs = true,
+        .vector_args_via_pointer = descr.is_windows(),
     }} {}
 
 codegen::SSALowerer *X8664Target::create_ssa_lowerer() {
@@ -25,6 +25,7 @@ public:
     std::vector<std::unique_ptr<codegen::MachinePass>> create_passes() override;
     std::string get_output_file_ext() override;
     codegen::Emitter *create_emitter(mcode::Module &module, std::ostream &stream) override;
+    bool supports_build_cache() override { return true; }
 };
 
 } // namespace banjo::target
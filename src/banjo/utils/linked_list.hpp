@@ -3,7 +3,9 @@
 
 #include "banjo/utils/macros.hpp"
 
+#include <new>
 #include <utility>
+#include <vector>
 
 namespace banjo {
 
@@ -15,6 +17,60 @@ struct LinkedListNode {
     LinkedListNode(T value) : value(std::move(value)) {}
 };
 
+// Allocates the nodes of linked lists in chunks and recycles the nodes that are removed. The chunks are kept small
+// because a pool is typically created for every function and most functions are short. Lists using a pool have to
+// be destroyed before the pool.
+template <typename T>
+class LinkedListNodePool {
+
+private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+
+    static constexpr unsigned CHUNK_LENGTH = 16;
+
+    std::vector<LinkedListNode<T> *> chunks;
+    FreeNode *free_nodes = nullptr;
+    unsigned next_index = CHUNK_LENGTH;
+
+public:
+    LinkedListNodePool() {}
+    LinkedListNodePool(const LinkedListNodePool &) = delete;
+
+    ~LinkedListNodePool() {
+        for (LinkedListNode<T> *chunk : chunks) {
+            ::operator delete(chunk);
+        }
+    }
+
+    LinkedListNodePool &operator=(const LinkedListNodePool &) = delete;
+
+    LinkedListNode<T> *create(T value) {
+        void *memory;
+
+        if (free_nodes) {
+            memory = free_nodes;
+            free_nodes = free_nodes->next;
+        } else {
+            if (next_index == CHUNK_LENGTH) {
+                void *chunk = ::operator new(CHUNK_LENGTH * sizeof(LinkedListNode<T>));
+                chunks.push_back(static_cast<LinkedListNode<T> *>(chunk));
+                next_index = 0;
+            }
+
+            memory = &chunks.back()[next_index++];
+        }
+
+        return new (memory) LinkedListNode<T>(std::move(value));
+    }
+
+    void destroy(LinkedListNode<T> *node) {
+        node->~LinkedListNode<T>();
+        free_nodes = new (node) FreeNode{free_nodes};
+    }
+};
+
 template <typename T>
 class LinkedListIter {
 
@@ -66,6 +122,7 @@ private:
     LinkedListNode<T> *header;
     LinkedListNode<T> *trailer;
     unsigned size;
+    LinkedListNodePool<T> *pool = nullptr;
 
 public:
     LinkedList() : size(0) {
@@ -88,17 +145,21 @@ public:
     LinkedList(LinkedList &&other) noexcept
       : header(std::exchange(other.header, nullptr)),
         trailer(std::exchange(other.trailer, nullptr)),
-        size(other.size) {}
+        size(other.size),
+        pool(std::exchange(other.pool, nullptr)) {}
 
     ~LinkedList() {
         if (!header) {
             return;
         }
 
-        for (LinkedListIter<T> iter = header->next; iter; ++iter) {
-            delete iter.get_prev().node;
+        for (LinkedListNode<T> *node = header->next; node != trailer;) {
+            LinkedListNode<T> *next = node->next;
+            destroy_node(node);
+            node = next;
         }
 
+        delete header;
         delete trailer;
     }
 
@@ -107,15 +168,34 @@ public:
     LinkedList &operator=(LinkedList &&other) noexcept {
         std::swap(header, other.header);
         std::swap(trailer, other.trailer);
+        std::swap(pool, other.pool);
         size = other.size;
         return *this;
     }
 
+    // Allocates all future nodes from `pool`. This is only allowed while the list is empty so that every node is
+    // returned to the allocator it came from.
+    void set_pool(LinkedListNodePool<T> *pool) {
+        ASSERT(size == 0);
+        this->pool = pool;
+    }
+
+    LinkedListNodePool<T> *get_pool() const { return pool; }
+
     LinkedListIter<T> append(T value) { return append(create_iter(std::move(value))); }
 
-    LinkedListIter<T> insert_before(LinkedListIter<T> iter, T value) { return insert_before(iter, create_iter(value)); }
-    LinkedListIter<T> insert_after(LinkedListIter<T> iter, T value) { return insert_after(iter, create_iter(value)); }
-    LinkedListIter<T> replace(LinkedListIter<T> iter, T value) { return replace(iter, create_iter(value)); }
+    LinkedListIter<T> insert_before(LinkedListIter<T> iter, T value) {
+        return insert_before(iter, create_iter(std::move(value)));
+    }
+
+    LinkedListIter<T> insert_after(LinkedListIter<T> iter, T value) {
+        return insert_after(iter, create_iter(std::move(value)));
+    }
+
+    LinkedListIter<T> replace(LinkedListIter<T> iter, T value) {
+        return replace(iter, create_iter(std::move(value)));
+    }
+
     LinkedListIter<T> append(LinkedListIter<T> new_iter) { return insert_before(trailer, new_iter); }
 
     LinkedListIter<T> insert_before(LinkedListIter<T> iter, LinkedListIter<T> new_iter) {
@@ -144,7 +224,7 @@ public:
         iter.node->prev->next = iter.node->next;
         iter.node->next->prev = iter.node->prev;
 
-        delete iter.node;
+        destroy_node(iter.node);
         size -= 1;
     }
 
@@ -156,11 +236,17 @@ public:
         iter.node->prev->next = new_iter.node;
         iter.node->next->prev = new_iter.node;
 
-        delete iter.node;
+        destroy_node(iter.node);
         return new_iter.node;
     }
 
-    LinkedListIter<T> create_iter(T value) { return new LinkedListNode<T>(std::move(value)); }
+    LinkedListIter<T> create_iter(T value) {
+        if (pool) {
+            return pool->create(std::move(value));
+        } else {
+            return new LinkedListNode<T>(std::move(value));
+        }
+    }
 
     LinkedListIter<T> get_header() const { return header; }
     LinkedListIter<T> get_trailer() const { return trailer; }
@@ -173,6 +259,15 @@ public:
 
     LinkedListIter<T> begin() const { return header->next; }
     LinkedListIter<T> end() const { return trailer; }
+
+private:
+    void destroy_node(LinkedListNode<T> *node) {
+        if (pool) {
+            pool->destroy(node);
+        } else {
+            delete node;
+        }
+    }
 };
 
 } // namespace banjo
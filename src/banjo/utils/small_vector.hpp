@@ -0,0 +1,199 @@
+#ifndef BANJO_UTILS_SMALL_VECTOR_H
+#define BANJO_UTILS_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace banjo::utils {
+
+// A vector that stores up to `InlineCapacity` elements inside the object itself and only allocates heap memory once
+// it grows beyond that. The interface mirrors the parts of `std::vector` that are used throughout the compiler so it
+// can be swapped in for short lists that are created in large numbers.
+template <typename T, unsigned InlineCapacity>
+class SmallVector {
+
+public:
+    typedef T value_type;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+private:
+    T *elements;
+    unsigned length = 0;
+    unsigned capacity = InlineCapacity;
+    alignas(T) unsigned char inline_storage[InlineCapacity * sizeof(T)];
+
+public:
+    SmallVector() : elements(get_inline_elements()) {}
+
+    SmallVector(std::initializer_list<T> values) : SmallVector() {
+        reserve(values.size());
+
+        for (const T &value : values) {
+            push_back(value);
+        }
+    }
+
+    template <typename Iterator>
+    SmallVector(Iterator first, Iterator last) : SmallVector() {
+        for (Iterator iter = first; iter != last; ++iter) {
+            push_back(*iter);
+        }
+    }
+
+    SmallVector(const SmallVector &other) : SmallVector() {
+        reserve(other.length);
+        std::uninitialized_copy(other.begin(), other.end(), elements);
+        length = other.length;
+    }
+
+    SmallVector(SmallVector &&other) noexcept : SmallVector() { take(std::move(other)); }
+
+    ~SmallVector() {
+        std::destroy(begin(), end());
+        release_heap_elements();
+    }
+
+    SmallVector &operator=(const SmallVector &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.length);
+            std::uninitialized_copy(other.begin(), other.end(), elements);
+            length = other.length;
+        }
+
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&other) noexcept {
+        if (this != &other) {
+            clear();
+            release_heap_elements();
+            elements = get_inline_elements();
+            capacity = InlineCapacity;
+            take(std::move(other));
+        }
+
+        return *this;
+    }
+
+    iterator begin() { return elements; }
+    const_iterator begin() const { return elements; }
+    iterator end() { return elements + length; }
+    const_iterator end() const { return elements + length; }
+
+    T *data() { return elements; }
+    const T *data() const { return elements; }
+    std::size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    T &operator[](std::size_t index) { return elements[index]; }
+    const T &operator[](std::size_t index) const { return elements[index]; }
+    T &front() { return elements[0]; }
+    T &back() { return elements[length - 1]; }
+
+    void push_back(T value) {
+        if (length == capacity) {
+            grow(2 * capacity);
+        }
+
+        new (&elements[length]) T(std::move(value));
+        length += 1;
+    }
+
+    template <typename... Args>
+    T &emplace_back(Args &&...args) {
+        push_back(T(std::forward<Args>(args)...));
+        return back();
+    }
+
+    void pop_back() {
+        length -= 1;
+        elements[length].~T();
+    }
+
+    iterator insert(const_iterator pos, T value) {
+        std::size_t index = pos - elements;
+        push_back(std::move(value));
+        std::rotate(elements + index, elements + length - 1, elements + length);
+        return elements + index;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator first_iter = elements + (first - elements);
+        iterator last_iter = elements + (last - elements);
+        iterator new_end = std::move(last_iter, end(), first_iter);
+        std::destroy(new_end, end());
+        length = new_end - elements;
+        return first_iter;
+    }
+
+    void resize(std::size_t new_length) {
+        reserve(new_length);
+
+        if (new_length < length) {
+            std::destroy(elements + new_length, end());
+        } else {
+            std::uninitialized_value_construct(end(), elements + new_length);
+        }
+
+        length = new_length;
+    }
+
+    void reserve(std::size_t new_capacity) {
+        if (new_capacity > capacity) {
+            grow(new_capacity);
+        }
+    }
+
+    void clear() {
+        std::destroy(begin(), end());
+        length = 0;
+    }
+
+    friend bool operator==(const SmallVector &lhs, const SmallVector &rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    T *get_inline_elements() { return reinterpret_cast<T *>(inline_storage); }
+    bool is_inline() const { return elements == reinterpret_cast<const T *>(inline_storage); }
+
+    void grow(std::size_t new_capacity) {
+        T *new_elements = static_cast<T *>(::operator new(new_capacity * sizeof(T)));
+        std::uninitialized_move(begin(), end(), new_elements);
+        std::destroy(begin(), end());
+        release_heap_elements();
+
+        elements = new_elements;
+        capacity = static_cast<unsigned>(new_capacity);
+    }
+
+    void release_heap_elements() {
+        if (!is_inline()) {
+            ::operator delete(elements);
+        }
+    }
+
+    void take(SmallVector &&other) {
+        if (other.is_inline()) {
+            std::uninitialized_move(other.begin(), other.end(), elements);
+            length = other.length;
+            other.clear();
+        } else {
+            elements = std::exchange(other.elements, other.get_inline_elements());
+            length = std::exchange(other.length, 0);
+            capacity = std::exchange(other.capacity, InlineCapacity);
+        }
+    }
+};
+
+} // namespace banjo::utils
+
+#endif
@@ -0,0 +1,175 @@
+#include "task_scheduler.hpp"
+
+#include <utility>
+
+namespace banjo {
+
+namespace utils {
+
+// The scheduler and deque index of the worker running on the current thread.
+static thread_local TaskScheduler *cur_scheduler = nullptr;
+static thread_local unsigned cur_deque_index = 0;
+
+TaskGroup::TaskGroup(TaskScheduler &scheduler) : scheduler(scheduler) {}
+
+TaskGroup::~TaskGroup() {
+    wait();
+}
+
+void TaskGroup::spawn(std::function<void()> function) {
+    num_pending.fetch_add(1);
+    scheduler.push(TaskScheduler::Task{.function = std::move(function), .group = this});
+}
+
+void TaskGroup::wait() {
+    while (num_pending.load() != 0) {
+        if (scheduler.try_run_one()) {
+            continue;
+        }
+
+        // All remaining tasks of this group are being executed by other threads. Sleep until
+        // either new work is queued or the group is done.
+        std::unique_lock lock(scheduler.sleep_mutex);
+        scheduler.num_sleeping.fetch_add(1);
+        scheduler.sleep_condition_variable.wait(lock, [this] {
+            return num_pending.load() == 0 || scheduler.num_queued.load() != 0;
+        });
+        scheduler.num_sleeping.fetch_sub(1);
+    }
+}
+
+TaskScheduler::TaskScheduler(unsigned num_threads)
+  : num_threads(num_threads == 0 ? 1 : num_threads),
+    deques(this->num_threads) {
+    for (unsigned i = 0; i < this->num_threads - 1; i++) {
+        workers.push_back(std::thread([this, i] { run_worker(i); }));
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    sleep_mutex.lock();
+    stopping = true;
+    sleep_mutex.unlock();
+    sleep_condition_variable.notify_all();
+
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+void TaskScheduler::push(Task task) {
+    unsigned index = cur_scheduler == this ? cur_deque_index : num_threads - 1;
+    TaskDeque &deque = deques[index];
+
+    // The counter is incremented first so it never drops below the number of queued tasks.
+    num_queued.fetch_add(1);
+
+    deque.mutex.lock();
+    deque.tasks.push_back(std::move(task));
+    deque.mutex.unlock();
+
+    wake_sleepers();
+}
+
+bool TaskScheduler::try_run_one() {
+    Task task;
+
+    if (!try_pop(task)) {
+        return false;
+    }
+
+    run_task(task);
+    return true;
+}
+
+bool TaskScheduler::try_pop(Task &task) {
+    if (num_queued.load() == 0) {
+        return false;
+    }
+
+    unsigned own_index = cur_scheduler == this ? cur_deque_index : num_threads - 1;
+
+    // Pop the most recently pushed task from the own deque for better locality.
+    TaskDeque &own_deque = deques[own_index];
+    own_deque.mutex.lock();
+
+    if (!own_deque.tasks.empty()) {
+        task = std::move(own_deque.tasks.back());
+        own_deque.tasks.pop_back();
+        own_deque.mutex.unlock();
+        num_queued.fetch_sub(1);
+        return true;
+    }
+
+    own_deque.mutex.unlock();
+
+    // Steal the oldest task from another deque. Older tasks tend to be larger, e.g. the upper
+    // halves of a range split by `parallel_for`.
+    for (unsigned offset = 1; offset < num_threads; offset++) {
+        TaskDeque &victim = deques[(own_index + offset) % num_threads];
+        victim.mutex.lock();
+
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            victim.mutex.unlock();
+            num_queued.fetch_sub(1);
+            return true;
+        }
+
+        victim.mutex.unlock();
+    }
+
+    return false;
+}
+
+void TaskScheduler::run_worker(unsigned index) {
+    cur_scheduler = this;
+    cur_deque_index = index;
+
+    while (true) {
+        if (try_run_one()) {
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex);
+        num_sleeping.fetch_add(1);
+        sleep_condition_variable.wait(lock, [this] { return stopping || num_queued.load() != 0; });
+        num_sleeping.fetch_sub(1);
+
+        if (stopping && num_queued.load() == 0) {
+            break;
+        }
+    }
+}
+
+void TaskScheduler::run_task(Task &task) {
+    task.function();
+
+    TaskGroup *group = task.group;
+
+    // The group may be destroyed as soon as the counter reaches zero, so it must not be accessed
+    // after the decrement. Threads waiting on the group are woken up under the sleep mutex so they
+    // don't miss the notification.
+    if (group->num_pending.fetch_sub(1) == 1) {
+        sleep_mutex.lock();
+        sleep_mutex.unlock();
+        sleep_condition_variable.notify_all();
+    }
+}
+
+void TaskScheduler::wake_sleepers() {
+    // Sleepers increment `num_sleeping` before checking `num_queued`, and the pusher increments
+    // `num_queued` before checking `num_sleeping`, so at least one side sees the other.
+    if (num_sleeping.load() == 0) {
+        return;
+    }
+
+    sleep_mutex.lock();
+    sleep_mutex.unlock();
+    sleep_condition_variable.notify_one();
+}
+
+} // namespace utils
+
+} // namespace banjo
@@ -0,0 +1,130 @@
+#ifndef BANJO_UTILS_TASK_SCHEDULER_H
+#define BANJO_UTILS_TASK_SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace banjo {
+
+namespace utils {
+
+class TaskScheduler;
+
+// A set of tasks that can be waited on. Tasks may spawn further tasks into the same group or into
+// new groups. Waiting on a group executes pending tasks on the waiting thread instead of blocking,
+// so groups can be nested arbitrarily deep without deadlocking the pool.
+class TaskGroup {
+
+    friend class TaskScheduler;
+
+private:
+    TaskScheduler &scheduler;
+    std::atomic<unsigned> num_pending{0};
+
+public:
+    TaskGroup(TaskScheduler &scheduler);
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup(TaskGroup &&) = delete;
+    ~TaskGroup();
+
+    TaskGroup &operator=(const TaskGroup &) = delete;
+    TaskGroup &operator=(TaskGroup &&) = delete;
+
+    void spawn(std::function<void()> function);
+    void wait();
+};
+
+// A work-stealing thread pool. Every worker has its own deque of tasks. Workers push and pop tasks
+// at the back of their own deque and steal from the front of the other deques when they run out
+// of work. Tasks spawned by threads outside of the pool go into a shared injection deque.
+//
+// The thread that waits on a task group helps executing tasks, so a scheduler with `num_threads`
+// threads only launches `num_threads - 1` workers. With a single thread, all tasks are executed by
+// the waiting thread.
+class TaskScheduler {
+
+    friend class TaskGroup;
+
+private:
+    struct Task {
+        std::function<void()> function;
+        TaskGroup *group;
+    };
+
+    struct TaskDeque {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    unsigned num_threads;
+    std::vector<std::thread> workers;
+
+    // One deque per worker plus the injection deque at the end.
+    std::vector<TaskDeque> deques;
+
+    std::atomic<unsigned> num_queued{0};
+    std::atomic<unsigned> num_sleeping{0};
+    bool stopping = false;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition_variable;
+
+public:
+    TaskScheduler(unsigned num_threads);
+    TaskScheduler(const TaskScheduler &) = delete;
+    TaskScheduler(TaskScheduler &&) = delete;
+    ~TaskScheduler();
+
+    TaskScheduler &operator=(const TaskScheduler &) = delete;
+    TaskScheduler &operator=(TaskScheduler &&) = delete;
+
+    unsigned get_num_threads() const { return num_threads; }
+
+    // Calls `function(i)` for every `i` in `[begin, end)` and blocks until all calls have returned.
+    // The range is split in halves recursively until the chunks are at most `grain_size` indices
+    // long, so idle workers steal large chunks first.
+    template <typename F>
+    void parallel_for(std::size_t begin, std::size_t end, F function, std::size_t grain_size = 1) {
+        if (begin >= end) {
+            return;
+        }
+
+        TaskGroup group(*this);
+        split_range(group, begin, end, function, grain_size == 0 ? 1 : grain_size);
+        group.wait();
+    }
+
+private:
+    template <typename F>
+    void split_range(TaskGroup &group, std::size_t begin, std::size_t end, F &function, std::size_t grain_size) {
+        while (end - begin > grain_size) {
+            std::size_t mid = begin + (end - begin) / 2;
+            group.spawn([this, &group, mid, end, &function, grain_size]() {
+                split_range(group, mid, end, function, grain_size);
+            });
+            end = mid;
+        }
+
+        for (std::size_t i = begin; i < end; i++) {
+            function(i);
+        }
+    }
+
+    void push(Task task);
+    bool try_run_one();
+    bool try_pop(Task &task);
+    void run_worker(unsigned index);
+    void run_task(Task &task);
+    void wake_sleepers();
+};
+
+} // namespace utils
+
+} // namespace banjo
+
+#endif
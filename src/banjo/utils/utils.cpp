@@ -71,6 +71,19 @@ std::string convert_eol_to_lf(std::string_view string) {
     return result;
 }
 
+std::string to_hex_string(std::uint64_t value, unsigned num_digits) {
+    static const char DIGITS[] = "0123456789abcdef";
+
+    std::string string(num_digits, '0');
+
+    for (unsigned i = 0; i < num_digits; i++) {
+        string[num_digits - i - 1] = DIGITS[value & 0xF];
+        value >>= 4;
+    }
+
+    return string;
+}
+
 LEB128Buffer encode_uleb128(std::uint64_t value) {
     // For reference: https://en.wikipedia.org/wiki/LEB128#Unsigned_LEB128
 
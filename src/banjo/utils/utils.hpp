@@ -4,6 +4,7 @@
 #include "banjo/utils/fixed_vector.hpp"
 #include "banjo/utils/large_int.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
@@ -127,6 +128,7 @@ std::vector<T> remove_duplicates(const std::vector<T> &array) {
 std::optional<std::uint64_t> parse_u64(std::string_view string);
 std::vector<std::string_view> split_string(std::string_view string, char delimiter);
 std::string convert_eol_to_lf(std::string_view string);
+std::string to_hex_string(std::uint64_t value, unsigned num_digits);
 
 LEB128Buffer encode_uleb128(std::uint64_t value);
 LEB128Buffer encode_sleb128(LargeInt value);
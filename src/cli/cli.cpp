@@ -78,6 +78,20 @@ static const ArgumentParser::Option OPTION_OPT_LEVEL{
     "Compiler optimization level",
 };
 
+static const ArgumentParser::Option OPTION_JOBS{
+    ArgumentParser::Option::Type::VALUE,
+    "jobs",
+    'j',
+    "{count}",
+    "Number of threads used by the compiler",
+};
+
+static const ArgumentParser::Option OPTION_NO_CACHE{
+    ArgumentParser::Option::Type::FLAG,
+    "no-cache",
+    "Disable the build cache",
+};
+
 static const ArgumentParser::Option OPTION_FORCE_ASM{
     ArgumentParser::Option::Type::FLAG,
     "force-asm",
@@ -136,6 +150,8 @@ static const ArgumentParser::Command COMMAND_BUILD{
         &OPTION_TARGET,
         &OPTION_CONFIG,
         &OPTION_OPT_LEVEL,
+        &OPTION_JOBS,
+        &OPTION_NO_CACHE,
         &OPTION_FORCE_ASM,
         &OPTION_DEBUG_COMPILER,
         &OPTION_QUIET,
@@ -152,6 +168,8 @@ static const ArgumentParser::Command COMMAND_RUN{
         &OPTION_HOT_RELOAD,
         &OPTION_CONFIG,
         &OPTION_OPT_LEVEL,
+        &OPTION_JOBS,
+        &OPTION_NO_CACHE,
         &OPTION_FORCE_ASM,
         &OPTION_DEBUG_COMPILER,
         &OPTION_QUIET,
@@ -166,6 +184,8 @@ static const ArgumentParser::Command COMMAND_TEST{
         &OPTION_HELP,
         &OPTION_CONFIG,
         &OPTION_OPT_LEVEL,
+        &OPTION_JOBS,
+        &OPTION_NO_CACHE,
         &OPTION_FORCE_ASM,
         &OPTION_DEBUG_COMPILER,
         &OPTION_QUIET,
@@ -182,6 +202,7 @@ static const ArgumentParser::Command COMMAND_INVOKE{
         &OPTION_TARGET,
         &OPTION_CONFIG,
         &OPTION_OPT_LEVEL,
+        &OPTION_JOBS,
         &OPTION_FORCE_ASM,
         &OPTION_DEBUG_COMPILER,
         &OPTION_QUIET,
@@ -381,6 +402,17 @@ void CLI::run(int argc, const char *argv[]) {
             } else {
                 error("unexpected optimization level '" + *option_value.value + "'");
             }
+        } else if (option == &OPTION_JOBS) {
+            std::optional<std::uint64_t> num_jobs = utils::parse_u64(*option_value.value);
+
+            if (!num_jobs || *num_jobs == 0) {
+                error("unexpected job count '" + *option_value.value + "'");
+            }
+
+            extra_compiler_args.push_back("--jobs");
+            extra_compiler_args.push_back(*option_value.value);
+        } else if (option == &OPTION_NO_CACHE) {
+            build_cache_enabled = false;
         } else if (option == &OPTION_FORCE_ASM) {
             force_assembler = true;
         } else if (option == &OPTION_HOT_RELOAD) {
@@ -1217,6 +1249,15 @@ ProcessResult CLI::invoke_compiler() {
         args.push_back("--hot-reload");
     }
 
+    if (build_cache_enabled) {
+        args.push_back("--cache-dir");
+        args.push_back((get_output_dir() / "cache").string());
+
+        if (verbose) {
+            args.push_back("--cache-stats");
+        }
+    }
+
     Command command{
         .executable = "banjo-compiler",
         .args = args,
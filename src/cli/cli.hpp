@@ -57,6 +57,7 @@ private:
     std::optional<unsigned> opt_level = {};
     bool force_assembler = false;
     bool hot_reloading_enabled = false;
+    bool build_cache_enabled = true;
     std::vector<std::string> extra_compiler_args;
 
     PackageType package_type;
@@ -0,0 +1,101 @@
+# Measures compile time and peak memory usage for a generated module with a few thousand functions. The functions
+# work on structs and loops, so the optimization passes have work to do. Run with
+# `python3 large_module.py --install-dir <dir> [--opt-level <level>]` to compare compiler versions.
+
+import argparse
+import os
+import resource
+import subprocess
+import tempfile
+import time
+
+NUM_FUNCS = 2000
+GROUP_SIZE = 20
+
+
+def generate_source():
+    lines = [
+        "struct Vec3 {",
+        "    var x: i32;",
+        "    var y: i32;",
+        "    var z: i32;",
+        "}",
+        "",
+    ]
+
+    for i in range(NUM_FUNCS):
+        lines += [
+            f"func func{i}(a: i32, b: i32) -> i32 {{",
+            "    var v = Vec3 { x: a, y: b, z: a + b };",
+            "    var total: i32 = 0;",
+            "",
+            f"    for j in 0..{i % 7 + 2} {{",
+            "        v.x = v.x * 3 + j;",
+            "        v.y = v.y - v.z;",
+            "        total += v.x + v.y + 0;",
+            "    }",
+            "",
+            f"    if total > {i} {{",
+            "        return total / 2;",
+            "    } else {",
+            "        return total * 1 + v.z;",
+            "    }",
+            "}",
+            "",
+        ]
+
+    # The calls are spread across small driver functions because a single huge `main` would dominate the timing.
+    for group in range(NUM_FUNCS // GROUP_SIZE):
+        lines += [f"func group{group}(seed: i32) -> i32 {{", "    var total = seed;"]
+
+        for i in range(group * GROUP_SIZE, (group + 1) * GROUP_SIZE):
+            lines.append(f"    total += func{i}(total, {i});")
+
+        lines += ["    return total;", "}", ""]
+
+    lines += ["func main() {", "    var total: i32 = 0;"]
+
+    for group in range(NUM_FUNCS // GROUP_SIZE):
+        lines.append(f"    total = group{group}(total);")
+
+    lines += ["    println(total);", "}"]
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--install-dir", required=True)
+    parser.add_argument("--opt-level", default="1")
+    parser.add_argument("--runs", type=int, default=3)
+    args = parser.parse_args()
+
+    compiler_path = os.path.abspath(f"{args.install_dir}/bin/banjo-compiler")
+
+    with tempfile.TemporaryDirectory() as directory:
+        with open(os.path.join(directory, "main.bnj"), "w") as f:
+            f.write(generate_source())
+
+        command = [
+            compiler_path,
+            *("--type", "executable"),
+            *("--arch", "x86_64"),
+            *("--os", "linux"),
+            *("--env", "gnu"),
+            *("--opt-level", args.opt_level),
+            *("--path", "."),
+        ]
+
+        best = None
+
+        for _ in range(args.runs):
+            start = time.perf_counter()
+            subprocess.run(command, cwd=directory, check=True)
+            duration = time.perf_counter() - start
+            best = duration if best is None else min(best, duration)
+
+    max_rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    print(f"best of {args.runs}: {best:.3f} s, peak RSS {max_rss / 1024:.1f} MiB")
+
+
+if __name__ == "__main__":
+    main()
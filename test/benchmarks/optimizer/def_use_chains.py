@@ -0,0 +1,111 @@
+# Measures how long the SSA passes take on a generated function with roughly 50,000 instructions. The passes replace
+# registers throughout the function and look up register definitions, which is cheap with def-use chains and
+# quadratic without them. Run with `python3 def_use_chains.py --install-dir <dir>` to compare compiler versions.
+
+import argparse
+import subprocess
+import time
+
+NUM_INSTRS = 50000
+
+
+def generate_peephole():
+    # Every other instruction adds zero and is eliminated by replacing its result everywhere.
+    lines = ["func i32 @test(i32):", "    %0 = loadarg i32, void 0"]
+    prev = 0
+
+    for i in range(NUM_INSTRS // 2):
+        zero_add = 2 * i + 1
+        mul = 2 * i + 2
+        lines.append(f"    %{zero_add} = add i32 %{prev}, i32 0")
+        lines.append(f"    %{mul} = mul i32 %{zero_add}, i32 3")
+        prev = mul
+
+    lines.append(f"    ret i32 %{prev}")
+    return "\n".join(lines)
+
+
+def generate_sroa():
+    # Every struct allocation is split into its members, which replaces each `memberptr` by a new allocation.
+    lines = [
+        "struct @Pair:",
+        "    field i32 @a",
+        "    field i32 @b",
+        "",
+        "func i32 @test(i32):",
+        "    %0 = loadarg i32, void 0",
+    ]
+
+    next_reg = 1
+    prev = 0
+
+    for _ in range(NUM_INSTRS // 8):
+        alloca, ptr_a, ptr_b, value_a, value_b, total = range(next_reg, next_reg + 6)
+        next_reg += 6
+
+        lines.append(f"    %{alloca} = alloca @Pair")
+        lines.append(f"    %{ptr_a} = memberptr @Pair, addr %{alloca}, void 0")
+        lines.append(f"    %{ptr_b} = memberptr @Pair, addr %{alloca}, void 1")
+        lines.append(f"    store i32 %{prev}, addr %{ptr_a}")
+        lines.append(f"    store i32 %{prev}, addr %{ptr_b}")
+        lines.append(f"    %{value_a} = load i32, addr %{ptr_a}")
+        lines.append(f"    %{value_b} = load i32, addr %{ptr_b}")
+        lines.append(f"    %{total} = add i32 %{value_a}, i32 %{value_b}")
+        prev = total
+
+    lines.append(f"    ret i32 %{prev}")
+    return "\n".join(lines)
+
+
+def generate_stack_to_reg():
+    # Promoting the stack slots turns the additions into constants, which are then folded one by one.
+    lines = ["func i32 @test():"]
+    next_reg = 0
+    prev = None
+
+    for i in range(NUM_INSTRS // 4):
+        slot, value, total = range(next_reg, next_reg + 3)
+        next_reg += 3
+
+        lines.append(f"    %{slot} = alloca i32")
+        lines.append(f"    store i32 {i % 100}, addr %{slot}")
+        lines.append(f"    %{value} = load i32, addr %{slot}")
+
+        if prev is None:
+            lines.append(f"    %{total} = add i32 %{value}, i32 1")
+        else:
+            lines.append(f"    %{total} = add i32 %{value}, i32 %{prev}")
+
+        prev = total
+
+    lines.append(f"    ret i32 %{prev}")
+    return "\n".join(lines)
+
+
+BENCHMARKS = [
+    ("peephole", generate_peephole),
+    ("sroa", generate_sroa),
+    ("stack_to_reg", generate_stack_to_reg),
+]
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--install-dir", required=True)
+    args = parser.parse_args()
+
+    util_path = f"{args.install_dir}/bin/banjo-test-util"
+
+    for pass_name, generate in BENCHMARKS:
+        source = generate()
+
+        start = time.perf_counter()
+        result = subprocess.run([util_path, "ssa", pass_name], input=source, stdout=subprocess.DEVNULL, text=True)
+        duration = time.perf_counter() - start
+
+        status = "" if result.returncode == 0 else f" (exit code {result.returncode})"
+        print(f"{pass_name}: {duration:.3f} s{status}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,227 @@
+#include "banjo/codegen/machine_pass.hpp"
+#include "banjo/codegen/reg_alloc_pass.hpp"
+#include "banjo/codegen/ssa_lowerer.hpp"
+#include "banjo/config/config.hpp"
+#include "banjo/ssa/module.hpp"
+#include "banjo/target/target.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace banjo;
+
+using Clock = std::chrono::steady_clock;
+
+// Number of values that are live at the same time. This is larger than the number of available
+// general-purpose registers, so the allocator also has to spill and evict.
+constexpr unsigned WINDOW_SIZE = 20;
+
+// Number of instructions per basic block, so that many live ranges cross block boundaries.
+constexpr unsigned BLOCK_SIZE = 256;
+
+// Number of values used inside of the loop kernel.
+constexpr unsigned NUM_LOOP_VALUES = 6;
+
+// Generates a function that computes `v[i] = v[i - 1] + v[i - WINDOW_SIZE]` for `num_values`
+// values, which is similar to the long straight-line functions produced by inlining.
+static void generate_func(ssa::Module &mod, unsigned num_values) {
+    ssa::Type i64{ssa::Primitive::I64};
+    ssa::CallingConv calling_conv = ssa::CallingConv::X86_64_SYS_V_ABI;
+
+    ssa::FunctionType type{.params = {i64}, .return_type = i64, .calling_conv = calling_conv};
+    ssa::Function *func = new ssa::Function("func", type);
+    mod.add(func);
+
+    ssa::BasicBlockIter block = func->get_entry_block_iter();
+    std::vector<ssa::VirtualRegister> values;
+
+    ssa::VirtualRegister arg = func->next_virtual_reg();
+    block->append({ssa::Opcode::LOADARG, arg, {ssa::Operand::from_type(i64), ssa::Operand::from_int_immediate(0)}});
+
+    for (unsigned i = 0; i < WINDOW_SIZE; i++) {
+        ssa::VirtualRegister value = func->next_virtual_reg();
+        ssa::Operand lhs = ssa::Operand::from_register(arg, i64);
+        ssa::Operand rhs = ssa::Operand::from_int_immediate(i, i64);
+        block->append({ssa::Opcode::ADD, value, {lhs, rhs}});
+        values.push_back(value);
+    }
+
+    for (unsigned i = WINDOW_SIZE; i < num_values; i++) {
+        if (i % BLOCK_SIZE == 0) {
+            ssa::BasicBlockIter next_block = func->create_block("b" + std::to_string(i));
+            func->append_block(next_block);
+            block->append({ssa::Opcode::JMP, {ssa::Operand::from_branch_target({.block = next_block, .args = {}})}});
+            block = next_block;
+        }
+
+        ssa::VirtualRegister value = func->next_virtual_reg();
+        ssa::Operand lhs = ssa::Operand::from_register(values[i - 1], i64);
+        ssa::Operand rhs = ssa::Operand::from_register(values[i - WINDOW_SIZE], i64);
+        block->append({ssa::Opcode::ADD, value, {lhs, rhs}});
+        values.push_back(value);
+    }
+
+    block->append({ssa::Opcode::RET, {ssa::Operand::from_register(values.back(), i64)}});
+}
+
+// Generates a loop that uses `NUM_LOOP_VALUES` of `num_values` values that are defined before the
+// loop and summed up after it, so the values that are not used in the loop should be spilled.
+static void generate_loop_kernel(ssa::Module &mod, unsigned num_values) {
+    ssa::Type i64{ssa::Primitive::I64};
+    ssa::CallingConv calling_conv = ssa::CallingConv::X86_64_SYS_V_ABI;
+
+    ssa::FunctionType type{.params = {i64, i64}, .return_type = i64, .calling_conv = calling_conv};
+    ssa::Function *func = new ssa::Function("kernel", type);
+    mod.add(func);
+
+    ssa::BasicBlockIter entry = func->get_entry_block_iter();
+    ssa::BasicBlockIter loop = func->create_block("loop");
+    ssa::BasicBlockIter exit = func->create_block("exit");
+    func->append_block(loop);
+    func->append_block(exit);
+
+    ssa::VirtualRegister arg = func->next_virtual_reg();
+    ssa::VirtualRegister count = func->next_virtual_reg();
+    entry->append({ssa::Opcode::LOADARG, arg, {ssa::Operand::from_type(i64), ssa::Operand::from_int_immediate(0)}});
+    entry->append({ssa::Opcode::LOADARG, count, {ssa::Operand::from_type(i64), ssa::Operand::from_int_immediate(1)}});
+
+    std::vector<ssa::VirtualRegister> values;
+
+    for (unsigned i = 0; i < num_values; i++) {
+        ssa::VirtualRegister value = func->next_virtual_reg();
+        ssa::Operand lhs = ssa::Operand::from_register(arg, i64);
+        ssa::Operand rhs = ssa::Operand::from_int_immediate(i, i64);
+        entry->append({ssa::Opcode::ADD, value, {lhs, rhs}});
+        values.push_back(value);
+    }
+
+    ssa::Operand zero = ssa::Operand::from_int_immediate(0, i64);
+    entry->append({ssa::Opcode::JMP, {ssa::Operand::from_branch_target({.block = loop, .args = {zero, zero}})}});
+
+    ssa::VirtualRegister index = func->next_virtual_reg();
+    ssa::VirtualRegister acc = func->next_virtual_reg();
+    loop->get_param_regs() = {index, acc};
+    loop->get_param_types() = {i64, i64};
+
+    ssa::VirtualRegister sum = acc;
+
+    for (unsigned i = 0; i < NUM_LOOP_VALUES; i++) {
+        ssa::VirtualRegister product = func->next_virtual_reg();
+        ssa::Operand lhs = ssa::Operand::from_register(values[i], i64);
+        ssa::Operand rhs = ssa::Operand::from_register(index, i64);
+        loop->append({ssa::Opcode::MUL, product, {lhs, rhs}});
+
+        ssa::VirtualRegister new_sum = func->next_virtual_reg();
+        lhs = ssa::Operand::from_register(sum, i64);
+        rhs = ssa::Operand::from_register(product, i64);
+        loop->append({ssa::Opcode::ADD, new_sum, {lhs, rhs}});
+        sum = new_sum;
+    }
+
+    ssa::VirtualRegister next_index = func->next_virtual_reg();
+    ssa::Operand one = ssa::Operand::from_int_immediate(1, i64);
+    loop->append({ssa::Opcode::ADD, next_index, {ssa::Operand::from_register(index, i64), one}});
+
+    ssa::Operand next_index_operand = ssa::Operand::from_register(next_index, i64);
+    ssa::Operand sum_operand = ssa::Operand::from_register(sum, i64);
+
+    loop->append(
+        {ssa::Opcode::CJMP,
+         {next_index_operand,
+          ssa::Operand::from_comparison(ssa::Comparison::SLT),
+          ssa::Operand::from_register(count, i64),
+          ssa::Operand::from_branch_target({.block = loop, .args = {next_index_operand, sum_operand}}),
+          ssa::Operand::from_branch_target({.block = exit, .args = {sum_operand}})}}
+    );
+
+    ssa::VirtualRegister result = func->next_virtual_reg();
+    exit->get_param_regs() = {result};
+    exit->get_param_types() = {i64};
+
+    for (ssa::VirtualRegister value : values) {
+        ssa::VirtualRegister new_result = func->next_virtual_reg();
+        ssa::Operand lhs = ssa::Operand::from_register(result, i64);
+        ssa::Operand rhs = ssa::Operand::from_register(value, i64);
+        exit->append({ssa::Opcode::ADD, new_result, {lhs, rhs}});
+        result = new_result;
+    }
+
+    exit->append({ssa::Opcode::RET, {ssa::Operand::from_register(result, i64)}});
+}
+
+static codegen::RegAllocPass::Stats run_reg_alloc(target::Target *target, ssa::Module &mod, double &milliseconds) {
+    std::unique_ptr<codegen::SSALowerer> lowerer{target->create_ssa_lowerer()};
+    lowerer->begin_module(mod);
+    lowerer->lower_func(*mod.get_functions()[0]);
+
+    mcode::Module machine_module = std::move(lowerer->get_machine_module());
+    mcode::Function &machine_func = *machine_module.get_functions()[0];
+
+    // The register allocator is the first machine pass.
+    std::unique_ptr<codegen::MachinePass> pass = std::move(target->create_passes()[0]);
+    codegen::RegAllocPass &reg_alloc_pass = static_cast<codegen::RegAllocPass &>(*pass);
+
+    Clock::time_point start = Clock::now();
+    reg_alloc_pass.run(machine_func);
+    Clock::time_point end = Clock::now();
+
+    milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+    return reg_alloc_pass.get_stats();
+}
+
+static void print_spill_stats(const codegen::RegAllocPass::Stats &stats) {
+    std::cout << "    " << stats.num_spill_loads << " spill loads, " << stats.num_spill_stores << " spill stores ("
+              << stats.num_spills_in_loops << " in loops), " << stats.num_splits << " splits" << std::endl;
+}
+
+static void run_benchmark(target::Target *target, unsigned num_values) {
+    ssa::Module mod;
+    generate_func(mod, num_values);
+
+    double milliseconds;
+    codegen::RegAllocPass::Stats stats = run_reg_alloc(target, mod, milliseconds);
+
+    std::cout << "  " << num_values << " virtual registers: " << milliseconds << " ms ("
+              << (milliseconds * 1000.0 / num_values) << " us per register)" << std::endl;
+    print_spill_stats(stats);
+}
+
+static void run_loop_kernel(target::Target *target, unsigned num_values) {
+    ssa::Module mod;
+    generate_loop_kernel(mod, num_values);
+
+    double milliseconds;
+    codegen::RegAllocPass::Stats stats = run_reg_alloc(target, mod, milliseconds);
+
+    std::cout << "  " << num_values << " values live across the loop:" << std::endl;
+    print_spill_stats(stats);
+}
+
+int main(int argc, const char *argv[]) {
+    unsigned max_values = argc > 1 ? std::atoi(argv[1]) : 40000;
+
+    target::TargetDescription descr{
+        target::Architecture::X86_64,
+        target::OperatingSystem::LINUX,
+        target::Environment::GNU,
+    };
+
+    Config::instance().target = descr;
+    std::unique_ptr<target::Target> target{target::Target::create(descr, target::CodeModel::SMALL)};
+
+    std::cout << "register allocation:" << std::endl;
+
+    for (unsigned num_values = 1250; num_values <= max_values; num_values *= 2) {
+        run_benchmark(target.get(), num_values);
+    }
+
+    std::cout << "loop kernel:" << std::endl;
+
+    for (unsigned num_values = 8; num_values <= 32; num_values += 8) {
+        run_loop_kernel(target.get(), num_values);
+    }
+}
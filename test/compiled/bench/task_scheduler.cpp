@@ -0,0 +1,83 @@
+#include "banjo/utils/task_scheduler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace banjo;
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+void measure(const std::string &name, std::uint64_t num_tasks, F function) {
+    Clock::time_point start = Clock::now();
+    function();
+    Clock::time_point end = Clock::now();
+
+    double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "  " << name << ": " << (nanoseconds / 1000000.0) << " ms (" << (nanoseconds / num_tasks)
+              << " ns per task)" << std::endl;
+}
+
+static std::uint64_t fib(utils::TaskScheduler &scheduler, unsigned n) {
+    if (n < 2) {
+        return n;
+    }
+
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+
+    utils::TaskGroup group(scheduler);
+    group.spawn([&scheduler, &a, n]() { a = fib(scheduler, n - 1); });
+    b = fib(scheduler, n - 2);
+    group.wait();
+
+    return a + b;
+}
+
+static void run_benchmarks(unsigned num_threads) {
+    constexpr std::uint64_t NUM_TASKS = 1000000;
+
+    utils::TaskScheduler scheduler(num_threads);
+    std::cout << num_threads << " thread(s):" << std::endl;
+
+    measure("spawn empty tasks", NUM_TASKS, [&scheduler]() {
+        utils::TaskGroup group(scheduler);
+
+        for (std::uint64_t i = 0; i < NUM_TASKS; i++) {
+            group.spawn([]() {});
+        }
+
+        group.wait();
+    });
+
+    measure("parallel for (grain size 1)", NUM_TASKS, [&scheduler]() {
+        std::atomic<std::uint64_t> sum{0};
+        scheduler.parallel_for(0, NUM_TASKS, [&sum](std::size_t i) { sum.fetch_add(i, std::memory_order_relaxed); });
+    });
+
+    measure("parallel for (grain size 1024)", NUM_TASKS / 1024, [&scheduler]() {
+        std::atomic<std::uint64_t> sum{0};
+        scheduler.parallel_for(
+            0,
+            NUM_TASKS,
+            [&sum](std::size_t i) { sum.fetch_add(i, std::memory_order_relaxed); },
+            1024
+        );
+    });
+
+    // fib(25) spawns one task per call that doesn't hit the base case.
+    measure("recursive fork/join (fib 25)", 121392, [&scheduler]() { fib(scheduler, 25); });
+}
+
+int main(int argc, const char *argv[]) {
+    unsigned max_threads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+
+    for (unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        run_benchmarks(num_threads);
+    }
+}
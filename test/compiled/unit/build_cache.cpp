@@ -0,0 +1,219 @@
+#include "banjo/codegen/build_cache.hpp"
+#include "banjo/codegen/fragment_serializer.hpp"
+#include "banjo/codegen/machine_pass.hpp"
+#include "banjo/codegen/ssa_lowerer.hpp"
+#include "banjo/config/config.hpp"
+#include "banjo/emit/emitter.hpp"
+#include "banjo/ssa/module.hpp"
+#include "banjo/target/target.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace banjo;
+
+template <typename R, typename E>
+void check_assertion(std::string description, R result, E expected) {
+    if (result != expected) {
+        std::cout << "assertion failed: " << description << std::endl;
+        std::cout << "    result: " << result << std::endl;
+        std::cout << "  expected: " << expected << std::endl;
+        std::exit(1);
+    }
+}
+
+#define ASSERT_EQUAL(result, expected) check_assertion(std::string(#result) + " == " + #expected, (result), (expected))
+#define ASSERT_TRUE(result) check_assertion(std::string(#result), (result), true)
+
+static const ssa::Type I32{ssa::Primitive::I32};
+static const ssa::Type F64{ssa::Primitive::F64};
+
+// Builds a module with a function that branches, calls an external function, and uses a
+// floating-point constant, so the fragments contain labels, symbols, and globals.
+static void build_module(ssa::Module &mod, long long constant) {
+    ssa::CallingConv calling_conv = ssa::CallingConv::X86_64_SYS_V_ABI;
+
+    ssa::FunctionDecl *extern_func = new ssa::FunctionDecl{
+        .name = "consume",
+        .type{.params = {F64}, .return_type = I32, .calling_conv = calling_conv},
+    };
+    mod.add(extern_func);
+
+    ssa::FunctionType func_type{.params = {I32, I32}, .return_type = I32, .calling_conv = calling_conv};
+    ssa::Function *func = new ssa::Function("select", func_type);
+    func->global = true;
+    mod.add(func);
+
+    ssa::BasicBlockIter entry = func->get_entry_block_iter();
+    ssa::BasicBlockIter then_block = func->create_block("then");
+    ssa::BasicBlockIter else_block = func->create_block("else");
+    func->append_block(then_block);
+    func->append_block(else_block);
+
+    ssa::VirtualRegister lhs = func->next_virtual_reg();
+    ssa::VirtualRegister rhs = func->next_virtual_reg();
+    ssa::VirtualRegister sum = func->next_virtual_reg();
+    ssa::VirtualRegister result = func->next_virtual_reg();
+
+    entry->append({ssa::Opcode::LOADARG, lhs, {ssa::Operand::from_type(I32), ssa::Operand::from_int_immediate(0)}});
+    entry->append({ssa::Opcode::LOADARG, rhs, {ssa::Operand::from_type(I32), ssa::Operand::from_int_immediate(1)}});
+    entry->append(
+        {ssa::Opcode::ADD, sum, {ssa::Operand::from_register(lhs, I32), ssa::Operand::from_register(rhs, I32)}}
+    );
+    entry->append(
+        {ssa::Opcode::CJMP,
+         {ssa::Operand::from_register(sum, I32),
+          ssa::Operand::from_comparison(ssa::Comparison::SGT),
+          ssa::Operand::from_int_immediate(constant, I32),
+          ssa::Operand::from_branch_target({.block = then_block, .args = {}}),
+          ssa::Operand::from_branch_target({.block = else_block, .args = {}})}}
+    );
+
+    then_block->append(
+        {ssa::Opcode::CALL,
+         result,
+         {ssa::Operand::from_extern_func(extern_func, I32), ssa::Operand::from_fp_immediate(1.5, F64)}}
+    );
+    then_block->append({ssa::Opcode::RET, {ssa::Operand::from_register(result, I32)}});
+
+    else_block->append({ssa::Opcode::RET, {ssa::Operand::from_register(sum, I32)}});
+}
+
+static mcode::Module lower(target::Target *target, ssa::Module &mod) {
+    std::unique_ptr<codegen::SSALowerer> lowerer{target->create_ssa_lowerer()};
+    lowerer->begin_module(mod);
+    lowerer->lower_func(*mod.get_functions()[0]);
+
+    mcode::Module fragment = std::move(lowerer->get_machine_module());
+
+    for (std::unique_ptr<codegen::MachinePass> &pass : target->create_passes()) {
+        pass->run(*fragment.get_functions()[0]);
+    }
+
+    return fragment;
+}
+
+static mcode::CallingConvention *get_calling_conv(target::Target *target, ssa::Module &mod) {
+    std::unique_ptr<codegen::SSALowerer> lowerer{target->create_ssa_lowerer()};
+    return lowerer->get_calling_convention(mod.get_functions()[0]->type.calling_conv);
+}
+
+static std::string emit(target::Target *target, mcode::Module &mod) {
+    // Fragments don't contain external symbols, these are added by the lowerer of the whole module.
+    mod.add_external_symbol("consume");
+
+    std::ostringstream stream;
+    std::unique_ptr<codegen::Emitter> emitter{target->create_emitter(mod, stream)};
+    emitter->generate();
+    return stream.str();
+}
+
+static void test_fragment_round_trip(target::Target *target) {
+    ssa::Module mod;
+    build_module(mod, 10);
+
+    mcode::Module fragment = lower(target, mod);
+    std::string expected = emit(target, fragment);
+
+    std::optional<std::vector<std::uint8_t>> data = codegen::FragmentWriter().write(fragment);
+    ASSERT_TRUE(data.has_value());
+
+    std::optional<mcode::Module> read_fragment = codegen::FragmentReader(*data).read(get_calling_conv(target, mod));
+    ASSERT_TRUE(read_fragment.has_value());
+    ASSERT_TRUE(emit(target, *read_fragment) == expected);
+
+    // Truncated data must be rejected instead of producing a broken fragment.
+    data->pop_back();
+    ASSERT_TRUE(!codegen::FragmentReader(*data).read(get_calling_conv(target, mod)).has_value());
+}
+
+static void test_keys() {
+    codegen::BuildCache cache({.dir = "", .size_limit = 0, .settings_hash = 1});
+    codegen::BuildCache other_settings_cache({.dir = "", .size_limit = 0, .settings_hash = 2});
+
+    ssa::Module mod_a;
+    ssa::Module mod_b;
+    ssa::Module mod_c;
+    build_module(mod_a, 10);
+    build_module(mod_b, 10);
+    build_module(mod_c, 11);
+
+    cache.begin_module(mod_a);
+    std::uint64_t key_a = cache.compute_key(*mod_a.get_functions()[0]);
+    cache.begin_module(mod_b);
+    std::uint64_t key_b = cache.compute_key(*mod_b.get_functions()[0]);
+    cache.begin_module(mod_c);
+    std::uint64_t key_c = cache.compute_key(*mod_c.get_functions()[0]);
+
+    other_settings_cache.begin_module(mod_a);
+    std::uint64_t key_other_settings = other_settings_cache.compute_key(*mod_a.get_functions()[0]);
+
+    ASSERT_EQUAL(key_a, key_b);
+    ASSERT_TRUE(key_a != key_c);
+    ASSERT_TRUE(key_a != key_other_settings);
+
+    // Changing the signature of a referenced function must invalidate the key.
+    mod_b.get_external_functions()[0]->type.params[0] = ssa::Type(ssa::Primitive::F32);
+    cache.begin_module(mod_b);
+    ASSERT_TRUE(cache.compute_key(*mod_b.get_functions()[0]) != key_a);
+}
+
+static void test_store_load_evict(target::Target *target) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "banjo-test-build-cache";
+    std::filesystem::remove_all(dir);
+
+    ssa::Module mod;
+    build_module(mod, 10);
+    mcode::Module fragment = lower(target, mod);
+    std::string expected = emit(target, fragment);
+    mcode::CallingConvention *calling_conv = get_calling_conv(target, mod);
+
+    codegen::BuildCache cache({.dir = dir, .size_limit = 1024 * 1024, .settings_hash = 1});
+    cache.begin_module(mod);
+    std::uint64_t key = cache.compute_key(*mod.get_functions()[0]);
+
+    ASSERT_TRUE(!cache.load(key, calling_conv).has_value());
+    cache.store(key, fragment);
+
+    std::optional<mcode::Module> loaded = cache.load(key, calling_conv);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_TRUE(emit(target, *loaded) == expected);
+
+    cache.evict();
+    codegen::BuildCache::Stats stats = cache.get_stats();
+    ASSERT_EQUAL(stats.num_hits, 1u);
+    ASSERT_EQUAL(stats.num_misses, 1u);
+    ASSERT_EQUAL(stats.num_stores, 1u);
+    ASSERT_EQUAL(stats.num_evictions, 0u);
+    ASSERT_EQUAL(stats.num_entries, 1u);
+
+    // A cache without any space left evicts every entry.
+    codegen::BuildCache full_cache({.dir = dir, .size_limit = 0, .settings_hash = 1});
+    full_cache.evict();
+    ASSERT_EQUAL(full_cache.get_stats().num_evictions, 1u);
+    ASSERT_EQUAL(full_cache.get_stats().num_entries, 0u);
+    ASSERT_TRUE(!full_cache.load(key, calling_conv).has_value());
+
+    std::filesystem::remove_all(dir);
+}
+
+int main() {
+    target::TargetDescription descr{
+        target::Architecture::X86_64,
+        target::OperatingSystem::LINUX,
+        target::Environment::GNU,
+    };
+
+    Config::instance().target = descr;
+    std::unique_ptr<target::Target> target{target::Target::create(descr, target::CodeModel::SMALL)};
+
+    test_fragment_round_trip(target.get());
+    test_keys();
+    test_store_load_evict(target.get());
+}
@@ -0,0 +1,114 @@
+#include "banjo/utils/task_scheduler.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace banjo;
+
+template <typename R, typename E>
+void check_assertion(std::string description, R result, E expected) {
+    if (result != expected) {
+        std::cout << "assertion failed: " << description << std::endl;
+        std::cout << "    result: " << result << std::endl;
+        std::cout << "  expected: " << expected << std::endl;
+        std::exit(1);
+    }
+}
+
+#define ASSERT_EQUAL(result, expected) check_assertion(std::string(#result) + " == " + #expected, (result), (expected))
+#define ASSERT_TRUE(result) check_assertion(std::string(#result), (result), true)
+
+static std::uint64_t fib(utils::TaskScheduler &scheduler, unsigned n) {
+    if (n < 2) {
+        return n;
+    }
+
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+
+    utils::TaskGroup group(scheduler);
+    group.spawn([&scheduler, &a, n]() { a = fib(scheduler, n - 1); });
+    b = fib(scheduler, n - 2);
+    group.wait();
+
+    return a + b;
+}
+
+static void test_groups(utils::TaskScheduler &scheduler) {
+    std::atomic<unsigned> counter{0};
+
+    utils::TaskGroup group(scheduler);
+
+    for (unsigned i = 0; i < 10000; i++) {
+        group.spawn([&counter]() { counter.fetch_add(1); });
+    }
+
+    group.wait();
+    ASSERT_EQUAL(counter.load(), 10000u);
+
+    // Waiting on an empty group must return immediately.
+    utils::TaskGroup empty_group(scheduler);
+    empty_group.wait();
+}
+
+static void test_nested_groups(utils::TaskScheduler &scheduler) {
+    ASSERT_EQUAL(fib(scheduler, 20), 6765u);
+}
+
+static void test_parallel_for(utils::TaskScheduler &scheduler) {
+    std::vector<unsigned> hits(100000, 0);
+
+    scheduler.parallel_for(0, hits.size(), [&hits](std::size_t i) { hits[i] += 1; });
+
+    for (unsigned hit : hits) {
+        ASSERT_EQUAL(hit, 1u);
+    }
+
+    std::atomic<std::uint64_t> sum{0};
+    scheduler.parallel_for(0, 1000, [&sum](std::size_t i) { sum.fetch_add(i); }, 64);
+    ASSERT_EQUAL(sum.load(), 499500u);
+
+    unsigned num_calls = 0;
+    scheduler.parallel_for(5, 5, [&num_calls](std::size_t) { num_calls += 1; });
+    ASSERT_EQUAL(num_calls, 0u);
+}
+
+static void test_nested_parallel_for(utils::TaskScheduler &scheduler) {
+    std::atomic<unsigned> counter{0};
+
+    scheduler.parallel_for(0, 64, [&scheduler, &counter](std::size_t) {
+        scheduler.parallel_for(0, 64, [&counter](std::size_t) { counter.fetch_add(1); });
+    });
+
+    ASSERT_EQUAL(counter.load(), 64u * 64u);
+}
+
+static void test_scheduler(unsigned num_threads) {
+    utils::TaskScheduler scheduler(num_threads);
+    ASSERT_EQUAL(scheduler.get_num_threads(), num_threads == 0 ? 1 : num_threads);
+
+    for (unsigned i = 0; i < 10; i++) {
+        test_groups(scheduler);
+        test_nested_groups(scheduler);
+        test_parallel_for(scheduler);
+        test_nested_parallel_for(scheduler);
+    }
+}
+
+int main(int argc, const char *argv[]) {
+    test_scheduler(0);
+    test_scheduler(1);
+    test_scheduler(2);
+    test_scheduler(4);
+    test_scheduler(16);
+
+    // Creating and destroying schedulers repeatedly must not leak or hang threads.
+    for (unsigned i = 0; i < 100; i++) {
+        utils::TaskScheduler scheduler(4);
+        test_nested_groups(scheduler);
+    }
+}
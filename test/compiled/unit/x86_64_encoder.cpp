@@ -321,6 +321,28 @@ int main(int, char *[]) {
     assemble_instr({X8664Opcode::CVTSD2SI, {random_gp_reg(8), random_sse_reg()}});
     assemble_instr({X8664Opcode::CVTSD2SI, {random_gp_reg(8), random_addr(8)}});
 
+    test_sse_r_rm(X8664Opcode::ADDPS);
+    test_sse_r_rm(X8664Opcode::ADDPD);
+    test_sse_r_rm(X8664Opcode::SUBPS);
+    test_sse_r_rm(X8664Opcode::SUBPD);
+    test_sse_r_rm(X8664Opcode::MULPS);
+    test_sse_r_rm(X8664Opcode::MULPD);
+    test_sse_r_rm(X8664Opcode::DIVPS);
+    test_sse_r_rm(X8664Opcode::DIVPD);
+    test_sse_r_rm(X8664Opcode::PADDD);
+    test_sse_r_rm(X8664Opcode::PSUBD);
+    test_sse_r_rm(X8664Opcode::PMULLD);
+    test_sse_r_rm(X8664Opcode::PCMPEQD);
+
+    assemble_instr({X8664Opcode::SHUFPS, {random_sse_reg(), random_sse_reg(), imm(1)}});
+    assemble_instr({X8664Opcode::SHUFPD, {random_sse_reg(), random_sse_reg(), imm(1)}});
+    assemble_instr({X8664Opcode::PSHUFD, {random_sse_reg(), random_sse_reg(), imm(1)}});
+    assemble_instr({X8664Opcode::CMPPS, {random_sse_reg(), random_sse_reg(), Operand::from_int_immediate(0, 1)}});
+    assemble_instr({X8664Opcode::CMPPD, {random_sse_reg(), random_sse_reg(), Operand::from_int_immediate(0, 1)}});
+    assemble_instr({X8664Opcode::MOVMSKPS, {random_gp_reg(4), random_sse_reg()}});
+    assemble_instr({X8664Opcode::MOVMSKPD, {random_gp_reg(4), random_sse_reg()}});
+    assemble_instr({X8664Opcode::MOVD, {random_sse_reg(), random_gp_reg(4)}});
+
     for (unsigned base = 0; base < 16; base++) {
         for (unsigned index = 0; index < 16; index++) {
             if (index == X8664Register::RSP) {
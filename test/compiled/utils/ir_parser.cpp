@@ -158,6 +158,7 @@ ssa::Opcode IRParser::parse_opcode() {
     else if (str == "offsetptr") return ssa::Opcode::OFFSETPTR;
     else if (str == "copy") return ssa::Opcode::COPY;
     else if (str == "sqrt") return ssa::Opcode::SQRT;
+    else if (str == "splat") return ssa::Opcode::SPLAT;
     else ASSERT_UNREACHABLE;
 }
 
@@ -202,6 +203,9 @@ ssa::Type IRParser::parse_type() {
         else if (str == "i64") return ssa::Primitive::I64;
         else if (str == "f32") return ssa::Primitive::F32;
         else if (str == "f64") return ssa::Primitive::F64;
+        else if (str == "f32x4") return ssa::Primitive::F32X4;
+        else if (str == "f64x2") return ssa::Primitive::F64X2;
+        else if (str == "i32x4") return ssa::Primitive::I32X4;
         else if (str == "addr") return ssa::Primitive::ADDR;
         else return ssa::Primitive::VOID;
     }